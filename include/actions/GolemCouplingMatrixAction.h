@@ -0,0 +1,39 @@
+/******************************************************************************/
+/*           GOLEM - Multiphysics of faulted geothermal reservoirs            */
+/*                                                                            */
+/*          Copyright (C) 2017 by Antoine B. Jacquey and Mauro Cacace         */
+/*             GFZ Potsdam, German Research Centre for Geosciences            */
+/*                                                                            */
+/*    This program is free software: you can redistribute it and/or modify    */
+/*    it under the terms of the GNU General Public License as published by    */
+/*      the Free Software Foundation, either version 3 of the License, or     */
+/*                     (at your option) any later version.                    */
+/*                                                                            */
+/*       This program is distributed in the hope that it will be useful,      */
+/*       but WITHOUT ANY WARRANTY; without even the implied warranty of       */
+/*        MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the       */
+/*                GNU General Public License for more details.                */
+/*                                                                            */
+/*      You should have received a copy of the GNU General Public License     */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/******************************************************************************/
+
+#pragma once
+
+#include "Action.h"
+
+/**
+ * Builds the Jacobian coupling matrix from the variables actually coupled by the
+ * kernels, boundary conditions and Dirac kernels of the problem, instead of the full
+ * variable-variable coupling set by the preconditioner. Scalar, interface, DG and
+ * nodal kernels and constraints are not scanned and the action errors if any is
+ * present.
+ */
+class GolemCouplingMatrixAction : public Action
+{
+public:
+  static InputParameters validParams();
+  GolemCouplingMatrixAction(const InputParameters & params);
+
+  virtual void act() override;
+};
@@ -29,6 +29,8 @@ public:
   static InputParameters validParams();
   GolemTimeControl(const InputParameters & parameters);
   virtual void execute() override;
+  // Whether the objects were switched (enabled/disabled) at the last execution
+  bool stateChanged() const { return _state_changed; }
 
 protected:
   void initialSetup() override;
@@ -37,4 +39,6 @@ protected:
 private:
   const std::vector<std::string> & _enable;
   const std::vector<std::string> & _disable;
+  Real _value;
+  bool _state_changed;
 };
\ No newline at end of file
@@ -0,0 +1,73 @@
+/******************************************************************************/
+/*           GOLEM - Multiphysics of faulted geothermal reservoirs            */
+/*                                                                            */
+/*          Copyright (C) 2017 by Antoine B. Jacquey and Mauro Cacace         */
+/*             GFZ Potsdam, German Research Centre for Geosciences            */
+/*                                                                            */
+/*    This program is free software: you can redistribute it and/or modify    */
+/*    it under the terms of the GNU General Public License as published by    */
+/*      the Free Software Foundation, either version 3 of the License, or     */
+/*                     (at your option) any later version.                    */
+/*                                                                            */
+/*       This program is distributed in the hope that it will be useful,      */
+/*       but WITHOUT ANY WARRANTY; without even the implied warranty of       */
+/*        MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the       */
+/*                GNU General Public License for more details.                */
+/*                                                                            */
+/*      You should have received a copy of the GNU General Public License     */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/******************************************************************************/
+
+#pragma once
+
+#include "DiracKernel.h"
+#include "GolemScaling.h"
+#include "GolemTimeSeries.h"
+
+/**
+ * Injection and extraction wells read from a well table, assembled in a single
+ * Dirac kernel. Each row of the table holds x y z type start_time end_time rate
+ * column: the type is injection (1) or extraction (2) and the rate is constant,
+ * or read from the given column of rate_file when column > 0 (rate being 0).
+ * Either rate only applies between start_time and end_time, weighted by the
+ * fraction of the time step within them. Wells at the same location share one
+ * Dirac point.
+ */
+class GolemDiracKernelWells : public DiracKernel
+{
+public:
+  static InputParameters validParams();
+  GolemDiracKernelWells(const InputParameters & parameters);
+  virtual void addPoints() override;
+  virtual void timestepSetup() override;
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+  void readWellTable();
+  // Net rate at each point for the current time step (injection counted negative)
+  void updateRates();
+
+  const std::string _well_table;
+  bool _has_scaled_properties;
+  std::unique_ptr<GolemTimeSeries> _rates;
+  bool _step;
+  // Wells
+  std::vector<unsigned int> _well_point;
+  std::vector<Real> _well_sign;
+  std::vector<Real> _start_time;
+  std::vector<Real> _end_time;
+  std::vector<Real> _in_out_rate;
+  std::vector<unsigned int> _column;
+  // Distinct well locations and their net rate, indexed by the id of the Dirac point
+  std::vector<Point> _points;
+  std::vector<Real> _point_rate;
+  Real _rates_t;
+  Real _rates_dt;
+  const MaterialProperty<Real> & _scaling_factor;
+  const MaterialProperty<Real> & _fluid_density;
+
+private:
+  const GolemScaling * _scaling_uo;
+  Real _scale;
+};
@@ -23,6 +23,12 @@
 #include "Function.h"
 #include "GolemSetBCFromFile.h"
 #include "GolemInterpolateBCFromFile.h"
+#include "GolemFileCache.h"
+
+#include <future>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
 
 class GolemFunctionBCFromFile : public Function
 {
@@ -31,22 +37,56 @@ public:
   GolemFunctionBCFromFile(const InputParameters & parameters);
   virtual ~GolemFunctionBCFromFile();
   virtual Real value(Real t, const Point & p) const override;
+  virtual void timestepSetup() override;
+  virtual void customSetup(const ExecFlagType & exec_type) override;
 
 protected:
-  GolemSetBCFromFile * _set_bc;
-  GolemInterpolateBCFromFile * _interpolate_bc;
+  const GolemSetBCFromFile * _set_bc;
+  const GolemInterpolateBCFromFile * _interpolate_bc;
   unsigned int _n_points;
   bool _has_interpol_in_time;
   bool _has_interpol_in_space;
   const std::string _data_file_name;
   std::vector<Real> _time_frames;
   std::vector<std::string> _file_names;
+  // Whether the time frames are read on demand instead of all at construction
+  const bool _stream_frames;
+  // Binary images of the parsed frame files
+  const GolemFileCache _cache;
+  const THREAD_ID _tid;
+
+  // Points and values of a time frame file
+  struct Frame
+  {
+    std::vector<Real> x;
+    std::vector<Real> y;
+    std::vector<Real> v;
+    std::string error;
+  };
+  // Interpolation objects built on the two time frames bracketing the current time
+  struct Window
+  {
+    unsigned int first;
+    std::unique_ptr<GolemSetBCFromFile> set_bc;
+    std::unique_ptr<GolemInterpolateBCFromFile> interpolate_bc;
+  };
+  mutable std::shared_ptr<const Window> _window;
+  // Frames of the current window and the one being prefetched
+  mutable std::map<unsigned int, std::shared_future<Frame>> _frames;
+  mutable std::shared_mutex _window_mutex;
 
 private:
   void parseFile();
   bool parseNextLineReals(std::ifstream & ifs, std::vector<Real> & myvec);
   bool parseNextLineStrings(std::ifstream & ifs, std::vector<std::string> & myvec);
   void fillMatrixBC(ColumnMajorMatrix & px, ColumnMajorMatrix & py, ColumnMajorMatrix & pz);
-  Real constant_value(Real t, const Point & pt) const;
-  Real interpolated_value(Real t, const Point & pt) const;
+  Frame readFrame(const std::string & file_name) const;
+  void broadcastFrame(Frame & frame) const;
+  // Window of the time t, collective when called on all the ranks together
+  std::shared_ptr<const Window> frameWindow(Real t, bool collective = false) const;
+  std::shared_ptr<const Window> loadWindow(unsigned int first, bool collective) const;
+  Real constant_value(const GolemSetBCFromFile & set_bc, Real t, const Point & pt) const;
+  Real interpolated_value(const GolemInterpolateBCFromFile & interpolate_bc,
+                          Real t,
+                          const Point & pt) const;
 };
\ No newline at end of file
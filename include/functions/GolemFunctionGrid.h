@@ -0,0 +1,40 @@
+/******************************************************************************/
+/*           GOLEM - Multiphysics of faulted geothermal reservoirs            */
+/*                                                                            */
+/*          Copyright (C) 2017 by Antoine B. Jacquey and Mauro Cacace         */
+/*             GFZ Potsdam, German Research Centre for Geosciences            */
+/*                                                                            */
+/*    This program is free software: you can redistribute it and/or modify    */
+/*    it under the terms of the GNU General Public License as published by    */
+/*      the Free Software Foundation, either version 3 of the License, or     */
+/*                     (at your option) any later version.                    */
+/*                                                                            */
+/*       This program is distributed in the hope that it will be useful,      */
+/*       but WITHOUT ANY WARRANTY; without even the implied warranty of       */
+/*        MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the       */
+/*                GNU General Public License for more details.                */
+/*                                                                            */
+/*      You should have received a copy of the GNU General Public License     */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/******************************************************************************/
+
+#pragma once
+
+#include "Function.h"
+#include "GolemGrid.h"
+
+/**
+ * Function sampling a field of a Golem binary grid file by trilinear
+ * interpolation.
+ */
+class GolemFunctionGrid : public Function
+{
+public:
+  static InputParameters validParams();
+  GolemFunctionGrid(const InputParameters & parameters);
+  virtual Real value(Real t, const Point & pt) const override;
+
+protected:
+  const GolemGrid _grid;
+  const unsigned int _field;
+};
@@ -21,6 +21,7 @@
 #pragma once
 
 #include "Function.h"
+#include "GolemTimeSeries.h"
 
 class GolemFunctionReadFile : public Function
 {
@@ -28,12 +29,13 @@ public:
   static InputParameters validParams();
   GolemFunctionReadFile(const InputParameters & parameters);
   virtual Real value(Real t, const Point & pt) const override;
+  virtual void customSetup(const ExecFlagType & exec_type) override;
 
 protected:
   const std::string _file;
-  std::vector<Real> _time;
-  std::vector<Real> _value;
-
-private:
-  void readFile();
+  const GolemFileCache _cache;
+  const GolemTimeSeries _series;
+  const unsigned int _column;
+  const bool _step;
+  const THREAD_ID _tid;
 };
\ No newline at end of file
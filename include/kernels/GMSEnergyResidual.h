@@ -21,14 +21,19 @@
 #pragma once
 
 #include "Kernel.h"
+#include "GolemKernelOperator.h"
 
-class GMSEnergyResidual : public Kernel
+class GMSEnergyResidual : public GolemKernelOperator<Kernel>
 {
 public:
   static InputParameters validParams();
   GMSEnergyResidual(const InputParameters & parameters);
 
 protected:
+  virtual bool affineResidual() const override { return true; }
+  virtual void computeQpFluxSource(const RealVectorValue & grad_u,
+                                   RealVectorValue & flux,
+                                   Real & source) override;
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
 
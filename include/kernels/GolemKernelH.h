@@ -21,16 +21,22 @@
 #pragma once
 
 #include "Kernel.h"
+#include "GolemKernelOperator.h"
 #include "DerivativeMaterialInterface.h"
 #include "RankTwoTensor.h"
 
-class GolemKernelH : public DerivativeMaterialInterface<Kernel>
+class GolemKernelH : public GolemKernelOperator<DerivativeMaterialInterface<Kernel>>
 {
 public:
   static InputParameters validParams();
   GolemKernelH(const InputParameters & parameters);
+  bool hasBoussinesq() const { return _has_boussinesq; }
 
 protected:
+  virtual bool affineResidual() const override { return !_has_boussinesq; }
+  virtual void computeQpFluxSource(const RealVectorValue & grad_u,
+                                   RealVectorValue & flux,
+                                   Real & source) override;
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
@@ -0,0 +1,49 @@
+/******************************************************************************/
+/*           GOLEM - Multiphysics of faulted geothermal reservoirs            */
+/*                                                                            */
+/*          Copyright (C) 2017 by Antoine B. Jacquey and Mauro Cacace         */
+/*             GFZ Potsdam, German Research Centre for Geosciences            */
+/*                                                                            */
+/*    This program is free software: you can redistribute it and/or modify    */
+/*    it under the terms of the GNU General Public License as published by    */
+/*      the Free Software Foundation, either version 3 of the License, or     */
+/*                     (at your option) any later version.                    */
+/*                                                                            */
+/*       This program is distributed in the hope that it will be useful,      */
+/*       but WITHOUT ANY WARRANTY; without even the implied warranty of       */
+/*        MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the       */
+/*                GNU General Public License for more details.                */
+/*                                                                            */
+/*      You should have received a copy of the GNU General Public License     */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/******************************************************************************/
+
+#pragma once
+
+#include "Kernel.h"
+#include "RankFourTensor.h"
+
+/**
+ * Fixed-stress stabilization of the flow equation for sequentially coupled HM
+ * simulations: biot^2 / K_dr * (pf - pf_k) / dt, where pf_k is the pore pressure
+ * seen by the mechanics in the previous coupling iteration. The term vanishes
+ * at convergence of the coupling iterations.
+ */
+class GolemKernelHFixedStress : public Kernel
+{
+public:
+  static InputParameters validParams();
+  GolemKernelHFixedStress(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+  Real computeQpStabilization();
+
+  const VariableValue & _pf_iterate;
+  bool _has_drained_bulk_modulus;
+  Real _drained_bulk_modulus;
+  Real _beta;
+  const MaterialProperty<Real> & _biot;
+  const MaterialProperty<RankFourTensor> * _M_jacobian;
+};
@@ -0,0 +1,41 @@
+/******************************************************************************/
+/*           GOLEM - Multiphysics of faulted geothermal reservoirs            */
+/*                                                                            */
+/*          Copyright (C) 2017 by Antoine B. Jacquey and Mauro Cacace         */
+/*             GFZ Potsdam, German Research Centre for Geosciences            */
+/*                                                                            */
+/*    This program is free software: you can redistribute it and/or modify    */
+/*    it under the terms of the GNU General Public License as published by    */
+/*      the Free Software Foundation, either version 3 of the License, or     */
+/*                     (at your option) any later version.                    */
+/*                                                                            */
+/*       This program is distributed in the hope that it will be useful,      */
+/*       but WITHOUT ANY WARRANTY; without even the implied warranty of       */
+/*        MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the       */
+/*                GNU General Public License for more details.                */
+/*                                                                            */
+/*      You should have received a copy of the GNU General Public License     */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/******************************************************************************/
+
+#pragma once
+
+#include "GolemKernelHourglass.h"
+#include "RankTwoTensor.h"
+
+/**
+ * Hourglass control of the pore pressure, scaled by the mean hydraulic
+ * conductivity (H_kernel) of the Golem material.
+ */
+class GolemKernelHHourglass : public GolemKernelHourglass
+{
+public:
+  static InputParameters validParams();
+  GolemKernelHHourglass(const InputParameters & parameters);
+
+protected:
+  virtual Real hourglassModulus() override;
+
+  const MaterialProperty<Real> & _scaling_factor;
+  const MaterialProperty<RankTwoTensor> & _H_kernel;
+};
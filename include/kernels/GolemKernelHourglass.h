@@ -0,0 +1,47 @@
+/******************************************************************************/
+/*           GOLEM - Multiphysics of faulted geothermal reservoirs            */
+/*                                                                            */
+/*          Copyright (C) 2017 by Antoine B. Jacquey and Mauro Cacace         */
+/*             GFZ Potsdam, German Research Centre for Geosciences            */
+/*                                                                            */
+/*    This program is free software: you can redistribute it and/or modify    */
+/*    it under the terms of the GNU General Public License as published by    */
+/*      the Free Software Foundation, either version 3 of the License, or     */
+/*                     (at your option) any later version.                    */
+/*                                                                            */
+/*       This program is distributed in the hope that it will be useful,      */
+/*       but WITHOUT ANY WARRANTY; without even the implied warranty of       */
+/*        MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the       */
+/*                GNU General Public License for more details.                */
+/*                                                                            */
+/*      You should have received a copy of the GNU General Public License     */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/******************************************************************************/
+
+#pragma once
+
+#include "Kernel.h"
+
+/**
+ * Flanagan-Belytschko stiffness hourglass control for HEX8 elements integrated with
+ * a one-point (reduced) quadrature rule. The stabilization only acts on the
+ * hourglass modes of the variable and vanishes for linear fields. The derived
+ * kernels provide the modulus scaling the hourglass stiffness.
+ */
+class GolemKernelHourglass : public Kernel
+{
+public:
+  static InputParameters validParams();
+  GolemKernelHourglass(const InputParameters & parameters);
+
+protected:
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual Real computeQpResidual() override { return 0.0; }
+  // Modulus scaling the hourglass stiffness, evaluated at the single quadrature point
+  virtual Real hourglassModulus() = 0;
+  bool computeHourglassStiffness();
+
+  Real _coefficient;
+  DenseMatrix<Real> _ke_hg;
+};
@@ -38,6 +38,11 @@ protected:
   virtual void computeOffDiagJacobian(unsigned int jvar) override;
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
   virtual void computeFiniteDeformJacobian();
+  Real elasticJacobian(const RankFourTensor & r4t,
+                       unsigned int i,
+                       unsigned int k,
+                       const RealGradient & grad_test,
+                       const RealGradient & grad_phi);
 
   const bool _has_pf;
   const bool _has_T;
@@ -0,0 +1,41 @@
+/******************************************************************************/
+/*           GOLEM - Multiphysics of faulted geothermal reservoirs            */
+/*                                                                            */
+/*          Copyright (C) 2017 by Antoine B. Jacquey and Mauro Cacace         */
+/*             GFZ Potsdam, German Research Centre for Geosciences            */
+/*                                                                            */
+/*    This program is free software: you can redistribute it and/or modify    */
+/*    it under the terms of the GNU General Public License as published by    */
+/*      the Free Software Foundation, either version 3 of the License, or     */
+/*                     (at your option) any later version.                    */
+/*                                                                            */
+/*       This program is distributed in the hope that it will be useful,      */
+/*       but WITHOUT ANY WARRANTY; without even the implied warranty of       */
+/*        MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the       */
+/*                GNU General Public License for more details.                */
+/*                                                                            */
+/*      You should have received a copy of the GNU General Public License     */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/******************************************************************************/
+
+#pragma once
+
+#include "GolemKernelHourglass.h"
+#include "RankFourTensor.h"
+
+/**
+ * Hourglass control of a displacement component, scaled by the shear modulus.
+ */
+class GolemKernelMHourglass : public GolemKernelHourglass
+{
+public:
+  static InputParameters validParams();
+  GolemKernelMHourglass(const InputParameters & parameters);
+
+protected:
+  virtual Real hourglassModulus() override;
+
+  bool _has_shear_modulus;
+  Real _shear_modulus;
+  const MaterialProperty<RankFourTensor> * _M_jacobian;
+};
@@ -21,15 +21,20 @@
 #pragma once
 
 #include "Kernel.h"
+#include "GolemKernelOperator.h"
 #include "DerivativeMaterialInterface.h"
 
-class GolemKernelT : public DerivativeMaterialInterface<Kernel>
+class GolemKernelT : public GolemKernelOperator<DerivativeMaterialInterface<Kernel>>
 {
 public:
   static InputParameters validParams();
   GolemKernelT(const InputParameters & parameters);
 
 protected:
+  virtual bool affineResidual() const override { return true; }
+  virtual void computeQpFluxSource(const RealVectorValue & grad_u,
+                                   RealVectorValue & flux,
+                                   Real & source) override;
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned int) override;
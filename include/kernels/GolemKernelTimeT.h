@@ -28,6 +28,7 @@ class GolemKernelTimeT : public DerivativeMaterialInterface<TimeDerivative>
 public:
   static InputParameters validParams();
   GolemKernelTimeT(const InputParameters & parameters);
+  bool hasBoussinesq() const { return _has_boussinesq; }
 
 protected:
   virtual void computeResidual() override;
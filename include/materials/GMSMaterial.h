@@ -21,15 +21,18 @@
 #pragma once
 
 #include "Material.h"
-#include "GolemPropertyReadFile.h"
+#include "GolemPropertyReader.h"
 
 class GMSMaterial : public Material
 {
 public:
   static InputParameters validParams();
   GMSMaterial(const InputParameters & parameters);
+  // Whether the properties do not depend on the temperature
+  bool hasConstantProperties() const { return !_has_lambda_pT; }
 
 protected:
+  virtual void computeProperties();
   virtual void computeQpProperties();
   Real computeEOSlambda(Real, Real);
 
@@ -47,7 +50,11 @@ protected:
   Real _h_prod;
   Real _scale_factor;
   // user object variable
-  const GolemPropertyReadFile * _read_prop_user_object;
+  const GolemPropertyReader * _read_prop_user_object;
+  // Columns of density, conductivity, heat capacity and heat production in the file
+  std::vector<unsigned int> _prop_index;
+  // Properties of the current element, read once for all quadrature points
+  std::vector<Real> _elem_data;
   // Properties
   MaterialProperty<Real> & _bulk_density;
   MaterialProperty<Real> & _bulk_thermal_conductivity;
@@ -38,6 +38,10 @@ public:
   void setQp(unsigned int qp);
   void resetQpProperties() final {}
   void resetProperties() final {}
+  /// Number of return-map iterations spent in the last call to updateStress
+  unsigned int returnMapIterations() const { return _return_map_its; }
+
 protected:
   const std::string _base_name;
+  unsigned int _return_map_its;
 };
\ No newline at end of file
@@ -36,6 +36,8 @@ public:
   static InputParameters validParams();
   GolemMaterialBase(const InputParameters & parameters);
   static MooseEnum materialType();
+  // Whether the kernel properties (and hence the Jacobian) do not change with the solution and time
+  virtual bool hasConstantProperties() const;
 
 protected:
   virtual void initQpStatefulProperties();
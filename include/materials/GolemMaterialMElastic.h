@@ -40,11 +40,15 @@ public:
   void setPropertiesHM();
   void setPropertiesTM();
   void setPropertiesTHM();
+  virtual bool hasConstantProperties() const override;
 
 protected:
   virtual void initQpStatefulProperties();
   virtual void computeProperties();
   virtual void computeStrain();
+  // Dimension specialized helpers skipping the zero padded displacement components
+  RankTwoTensor displacementGradient(const std::vector<const VariableGradient *> & grad_disp) const;
+  RankTwoTensor elasticStress(const RankTwoTensor & strain) const;
   virtual void computeQpFiniteStrain();
   virtual void computeQpProperties();
   virtual void GolemCrackClosure();
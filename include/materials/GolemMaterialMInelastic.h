@@ -28,6 +28,7 @@ public:
   static InputParameters validParams();
   GolemMaterialMInelastic(const InputParameters & parameters);
   virtual void initialSetup() override;
+  virtual bool hasConstantProperties() const override { return false; }
 
 protected:
   virtual void initQpStatefulProperties();
@@ -46,6 +47,7 @@ protected:
   std::vector<GolemInelasticBase *> _models;
   MaterialProperty<RankTwoTensor> & _inelastic_strain;
   const MaterialProperty<RankTwoTensor> & _inelastic_strain_old;
+  MaterialProperty<Real> & _return_map_iterations;
   const enum class TangentOperatorEnum { elastic, nonlinear } _tangent_operator_type;
   const unsigned _num_models;
 };
\ No newline at end of file
@@ -30,6 +30,7 @@ class GolemMaterialTH : public GolemMaterialH
 public:
   static InputParameters validParams();
   GolemMaterialTH(const InputParameters & parameters);
+  virtual bool hasConstantProperties() const override { return false; }
 
 protected:
   virtual void computeProperties();
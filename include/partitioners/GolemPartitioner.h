@@ -0,0 +1,62 @@
+/******************************************************************************/
+/*           GOLEM - Multiphysics of faulted geothermal reservoirs            */
+/*                                                                            */
+/*          Copyright (C) 2017 by Antoine B. Jacquey and Mauro Cacace         */
+/*             GFZ Potsdam, German Research Centre for Geosciences            */
+/*                                                                            */
+/*    This program is free software: you can redistribute it and/or modify    */
+/*    it under the terms of the GNU General Public License as published by    */
+/*      the Free Software Foundation, either version 3 of the License, or     */
+/*                     (at your option) any later version.                    */
+/*                                                                            */
+/*       This program is distributed in the hope that it will be useful,      */
+/*       but WITHOUT ANY WARRANTY; without even the implied warranty of       */
+/*        MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the       */
+/*                GNU General Public License for more details.                */
+/*                                                                            */
+/*      You should have received a copy of the GNU General Public License     */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/******************************************************************************/
+
+#pragma once
+
+#include "PetscExternalPartitioner.h"
+
+/**
+ * Graph partitioner weighting the elements by their expected assembly cost.
+ * The cost combines a weight per block, a weight for the lower-dimensional
+ * (fracture and well) elements and the return-map iterations measured by
+ * GolemRepartition over the previous time steps. Lower-dimensional elements
+ * can be moved to the processor of their host element to limit ghosting.
+ */
+class GolemPartitioner : public PetscExternalPartitioner
+{
+public:
+  static InputParameters validParams();
+  GolemPartitioner(const InputParameters & params);
+  virtual std::unique_ptr<Partitioner> clone() const override;
+  virtual dof_id_type computeElementWeight(Elem & elem) override;
+
+  // Mean return-map iterations per quadrature point, by element id
+  void setReturnMapIterations(const std::map<dof_id_type, Real> & iterations);
+  // Expected cost of an element relative to a unit element without plasticity
+  Real elementCost(const Elem & elem) const;
+  // Max over mean cost per processor of the last partition of the measured elements
+  Real imbalance() const { return _imbalance; }
+
+protected:
+  virtual void _do_partition(MeshBase & mesh, const unsigned int n) override;
+  void colocateLowerDimensionalElements(MeshBase & mesh);
+  void computeImbalance(const MeshBase & mesh, const unsigned int n);
+
+  const std::vector<SubdomainName> _block_names;
+  const std::vector<Real> _block_weights;
+  const Real _frac_weight;
+  const Real _well_weight;
+  const Real _iteration_weight;
+  const bool _colocate;
+  std::map<SubdomainID, Real> _weight_by_block;
+  unsigned int _mesh_dim;
+  std::map<dof_id_type, Real> _iterations;
+  Real _imbalance;
+};
@@ -0,0 +1,61 @@
+/******************************************************************************/
+/*           GOLEM - Multiphysics of faulted geothermal reservoirs            */
+/*                                                                            */
+/*          Copyright (C) 2017 by Antoine B. Jacquey and Mauro Cacace         */
+/*             GFZ Potsdam, German Research Centre for Geosciences            */
+/*                                                                            */
+/*    This program is free software: you can redistribute it and/or modify    */
+/*    it under the terms of the GNU General Public License as published by    */
+/*      the Free Software Foundation, either version 3 of the License, or     */
+/*                     (at your option) any later version.                    */
+/*                                                                            */
+/*       This program is distributed in the hope that it will be useful,      */
+/*       but WITHOUT ANY WARRANTY; without even the implied warranty of       */
+/*        MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the       */
+/*                GNU General Public License for more details.                */
+/*                                                                            */
+/*      You should have received a copy of the GNU General Public License     */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/******************************************************************************/
+
+#pragma once
+
+#include "ElementPostprocessor.h"
+
+#include <unordered_map>
+
+/**
+ * Number of quadrature points lying on the yield surface of a Golem
+ * plasticity model (plastic_yield_function within tolerance of zero).
+ * The plastic state of each quadrature point is kept so that the points
+ * turning plastic since the last snapshot (e.g. the last Jacobian rebuild)
+ * can be counted.
+ */
+class GolemPlasticPoints : public ElementPostprocessor
+{
+public:
+  static InputParameters validParams();
+  GolemPlasticPoints(const InputParameters & parameters);
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+  virtual Real getValue() const override;
+  virtual void initialSetup() override;
+  // Number of quadrature points plastic now but elastic at the last snapshot
+  Real newPlasticPoints() const { return _new_count; }
+  // Stores the current plastic state as the reference for newPlasticPoints()
+  void snapshot();
+
+protected:
+  const std::string _base_name;
+  const MaterialProperty<Real> & _yf;
+  Real _f_tol;
+  Real _count;
+  Real _new_count;
+  // Plastic state per (local) element and quadrature point, current and at the last snapshot
+  std::unordered_map<dof_id_type, std::vector<bool>> _plastic;
+  std::unordered_map<dof_id_type, std::vector<bool>> _plastic_snapshot;
+  // The snapshot is held by the thread 0 copy
+  const GolemPlasticPoints * _primary;
+};
@@ -0,0 +1,45 @@
+/******************************************************************************/
+/*           GOLEM - Multiphysics of faulted geothermal reservoirs            */
+/*                                                                            */
+/*          Copyright (C) 2017 by Antoine B. Jacquey and Mauro Cacace         */
+/*             GFZ Potsdam, German Research Centre for Geosciences            */
+/*                                                                            */
+/*    This program is free software: you can redistribute it and/or modify    */
+/*    it under the terms of the GNU General Public License as published by    */
+/*      the Free Software Foundation, either version 3 of the License, or     */
+/*                     (at your option) any later version.                    */
+/*                                                                            */
+/*       This program is distributed in the hope that it will be useful,      */
+/*       but WITHOUT ANY WARRANTY; without even the implied warranty of       */
+/*        MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the       */
+/*                GNU General Public License for more details.                */
+/*                                                                            */
+/*      You should have received a copy of the GNU General Public License     */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/******************************************************************************/
+
+#pragma once
+
+#include "ElementPostprocessor.h"
+
+/**
+ * Relative L2 change of the volumetric strain rate between two consecutive
+ * (macro) time steps. Used as error indicator for multirate HM/THM simulations.
+ */
+class GolemVolumetricStrainRateChange : public ElementPostprocessor
+{
+public:
+  static InputParameters validParams();
+  GolemVolumetricStrainRateChange(const InputParameters & parameters);
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+  virtual Real getValue() const override;
+
+protected:
+  const MaterialProperty<Real> & _vol_strain_rate;
+  const MaterialProperty<Real> & _vol_strain_rate_old;
+  Real _change;
+  Real _reference;
+};
@@ -0,0 +1,59 @@
+/******************************************************************************/
+/*           GOLEM - Multiphysics of faulted geothermal reservoirs            */
+/*                                                                            */
+/*          Copyright (C) 2017 by Antoine B. Jacquey and Mauro Cacace         */
+/*             GFZ Potsdam, German Research Centre for Geosciences            */
+/*                                                                            */
+/*    This program is free software: you can redistribute it and/or modify    */
+/*    it under the terms of the GNU General Public License as published by    */
+/*      the Free Software Foundation, either version 3 of the License, or     */
+/*                     (at your option) any later version.                    */
+/*                                                                            */
+/*       This program is distributed in the hope that it will be useful,      */
+/*       but WITHOUT ANY WARRANTY; without even the implied warranty of       */
+/*        MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the       */
+/*                GNU General Public License for more details.                */
+/*                                                                            */
+/*      You should have received a copy of the GNU General Public License     */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/******************************************************************************/
+
+#pragma once
+
+#include "TimeStepper.h"
+#include "PostprocessorInterface.h"
+
+/**
+ * Macro time step of the mechanics in a multirate simulation. The macro step
+ * is always a multiple of the (fixed) sub-step of the sub-cycled flow/heat
+ * application and the number of sub-steps is adapted from an error indicator
+ * on the change of the volumetric strain rate.
+ */
+class GolemMultirateDT : public TimeStepper, public PostprocessorInterface
+{
+public:
+  static InputParameters validParams();
+  GolemMultirateDT(const InputParameters & parameters);
+
+protected:
+  virtual Real computeInitialDT() override;
+  virtual Real computeDT() override;
+  virtual Real computeFailedDT() override;
+  virtual void acceptStep() override;
+  virtual void rejectStep() override;
+  unsigned int clampSubSteps(Real n) const;
+
+  const PostprocessorValue & _indicator;
+  Real _micro_dt;
+  unsigned int _initial_substeps;
+  unsigned int _min_substeps;
+  unsigned int _max_substeps;
+  Real _tolerance;
+  Real _growth_factor;
+  Real _cutback_factor;
+  unsigned int _substeps;
+  // Number of sub-steps of the last converged macro step
+  unsigned int _substeps_old;
+  // Number of sub-steps of the rejected macro step (0 if the last step converged)
+  unsigned int _failed_substeps;
+};
@@ -0,0 +1,78 @@
+/******************************************************************************/
+/*           GOLEM - Multiphysics of faulted geothermal reservoirs            */
+/*                                                                            */
+/*          Copyright (C) 2017 by Antoine B. Jacquey and Mauro Cacace         */
+/*             GFZ Potsdam, German Research Centre for Geosciences            */
+/*                                                                            */
+/*    This program is free software: you can redistribute it and/or modify    */
+/*    it under the terms of the GNU General Public License as published by    */
+/*      the Free Software Foundation, either version 3 of the License, or     */
+/*                     (at your option) any later version.                    */
+/*                                                                            */
+/*       This program is distributed in the hope that it will be useful,      */
+/*       but WITHOUT ANY WARRANTY; without even the implied warranty of       */
+/*        MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the       */
+/*                GNU General Public License for more details.                */
+/*                                                                            */
+/*      You should have received a copy of the GNU General Public License     */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/******************************************************************************/
+
+#pragma once
+
+#include "GeneralUserObject.h"
+#include "libmesh/dense_matrix.h"
+#include "libmesh/dense_vector.h"
+
+/**
+ * Storage of the local element matrices (and constant load vectors) of linear
+ * diffusion kernels on blocks with constant material properties. Kernels using
+ * this cache replace their quadrature loops by a local matrix-vector product.
+ */
+class GolemElementMatrixCache : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+  GolemElementMatrixCache(const InputParameters & parameters);
+  virtual void initialSetup() override;
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+  virtual void meshChanged() override;
+
+  struct Entry
+  {
+    DenseMatrix<Real> ke;
+    DenseVector<Real> re;
+    bool has_re;
+  };
+
+  // Index of a kernel in the cache, to be called at construction of the kernel
+  unsigned int kernelIndex(const std::string & kernel_name) const;
+  // Cached entry for a kernel and an element, NULL if not stored
+  Entry * find(unsigned int kernel, const Elem * elem, THREAD_ID tid) const;
+  // Store the element matrix, returns false if the block is not cacheable or the memory cap is hit
+  bool
+  insert(unsigned int kernel, const Elem * elem, const DenseMatrix<Real> & ke, THREAD_ID tid) const;
+  // Store the constant part of the residual (re - ke * u)
+  void insertResidual(Entry & entry,
+                      const DenseVector<Number> & re,
+                      const MooseArray<Number> & u) const;
+  // Local residual computed from the cache (ke * u + re)
+  void residual(const Entry & entry, const MooseArray<Number> & u, DenseVector<Number> & re) const;
+
+protected:
+  bool constantBlock(SubdomainID block) const;
+  void updateBlocks();
+  void clear();
+
+  std::size_t _max_memory;
+  std::set<SubdomainID> _cacheable_blocks;
+  // The cache is filled by the kernels during assembly
+  mutable std::map<std::string, unsigned int> _kernels;
+  // Per thread: per kernel: element id -> entry
+  mutable std::vector<std::vector<std::unordered_map<dof_id_type, Entry>>> _entries;
+  mutable std::vector<std::size_t> _memory;
+  mutable std::vector<bool> _capped;
+  mutable std::vector<unsigned long> _hits;
+};
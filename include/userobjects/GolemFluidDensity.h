@@ -34,6 +34,8 @@ public:
   virtual Real computeDensity(Real pressure, Real temperature, Real rho0) const = 0;
   virtual Real computedDensitydT(Real pressure, Real temperature, Real rho0) const = 0;
   virtual Real computedDensitydp(Real pressure, Real temperature) const = 0;
+  // Whether the density is independent of pressure and temperature
+  virtual bool isConstant() const { return false; }
 
 protected:
   bool _has_scaled_properties;
@@ -30,4 +30,5 @@ public:
   Real computeDensity(Real, Real, Real rho0) const;
   Real computedDensitydT(Real, Real, Real) const;
   Real computedDensitydp(Real, Real) const;
+  bool isConstant() const { return true; }
 };
\ No newline at end of file
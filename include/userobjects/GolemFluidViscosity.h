@@ -34,6 +34,8 @@ public:
   virtual Real computeViscosity(Real temperature, Real rho, Real mu0) const = 0;
   virtual Real computedViscositydT(Real temperature, Real rho, Real drho_dT, Real mu0) const = 0;
   virtual Real computedViscositydp(Real temperature, Real rho, Real drho_dp) const = 0;
+  // Whether the viscosity is independent of pressure and temperature
+  virtual bool isConstant() const { return false; }
 
 protected:
   bool _has_scaled_properties;
@@ -30,4 +30,5 @@ public:
   Real computeViscosity(Real, Real, Real mu0) const;
   Real computedViscositydT(Real, Real, Real, Real) const;
   Real computedViscositydp(Real, Real, Real) const;
+  bool isConstant() const { return true; }
 };
\ No newline at end of file
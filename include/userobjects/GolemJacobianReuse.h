@@ -0,0 +1,61 @@
+/******************************************************************************/
+/*           GOLEM - Multiphysics of faulted geothermal reservoirs            */
+/*                                                                            */
+/*          Copyright (C) 2017 by Antoine B. Jacquey and Mauro Cacace         */
+/*             GFZ Potsdam, German Research Centre for Geosciences            */
+/*                                                                            */
+/*    This program is free software: you can redistribute it and/or modify    */
+/*    it under the terms of the GNU General Public License as published by    */
+/*      the Free Software Foundation, either version 3 of the License, or     */
+/*                     (at your option) any later version.                    */
+/*                                                                            */
+/*       This program is distributed in the hope that it will be useful,      */
+/*       but WITHOUT ANY WARRANTY; without even the implied warranty of       */
+/*        MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the       */
+/*                GNU General Public License for more details.                */
+/*                                                                            */
+/*      You should have received a copy of the GNU General Public License     */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/******************************************************************************/
+
+#pragma once
+
+#include "GeneralUserObject.h"
+
+#include <petscsnes.h>
+
+class GolemPlasticPoints;
+class GolemTimeControl;
+
+/**
+ * Jacobian and preconditioner lagging policy. The Jacobian (and preconditioner)
+ * is kept across Newton iterations and time steps and only rebuilt when a
+ * quadrature point turns plastic (checked at every nonlinear iteration against
+ * the plastic state at the last rebuild), the time step changes, a
+ * GolemTimeControl switches objects or the Newton contraction rate deteriorates.
+ */
+class GolemJacobianReuse : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+  GolemJacobianReuse(const InputParameters & parameters);
+  virtual void initialSetup() override;
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+protected:
+  bool rebuildPending() const;
+  void requestRebuild(const std::string & reason);
+  static PetscErrorCode monitor(SNES snes, PetscInt it, PetscReal fnorm, void * ctx);
+
+  Real _contraction;
+  bool _rebuild_on_dt_change;
+  GolemPlasticPoints * _plastic_points;
+  std::vector<const GolemTimeControl *> _controls;
+  SNES _snes;
+  Real _dt_previous;
+  Real _fnorm_previous;
+  unsigned int _newton_its;
+  unsigned int _rebuilds;
+};
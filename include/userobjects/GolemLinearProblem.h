@@ -0,0 +1,54 @@
+/******************************************************************************/
+/*           GOLEM - Multiphysics of faulted geothermal reservoirs            */
+/*                                                                            */
+/*          Copyright (C) 2017 by Antoine B. Jacquey and Mauro Cacace         */
+/*             GFZ Potsdam, German Research Centre for Geosciences            */
+/*                                                                            */
+/*    This program is free software: you can redistribute it and/or modify    */
+/*    it under the terms of the GNU General Public License as published by    */
+/*      the Free Software Foundation, either version 3 of the License, or     */
+/*                     (at your option) any later version.                    */
+/*                                                                            */
+/*       This program is distributed in the hope that it will be useful,      */
+/*       but WITHOUT ANY WARRANTY; without even the implied warranty of       */
+/*        MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the       */
+/*                GNU General Public License for more details.                */
+/*                                                                            */
+/*      You should have received a copy of the GNU General Public License     */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/******************************************************************************/
+
+#pragma once
+
+#include "GeneralUserObject.h"
+
+#include <petscsnes.h>
+
+/**
+ * Linear mode: if all kernels and materials of the problem lead to a linear system
+ * with constant coefficients, the Jacobian and the preconditioner (factorization)
+ * are built once and reused across time steps as long as the time step is unchanged.
+ */
+class GolemLinearProblem : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+  GolemLinearProblem(const InputParameters & parameters);
+  virtual void initialSetup() override;
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+protected:
+  bool linearMaterials() const;
+  bool linearKernels() const;
+  bool linearBCs() const;
+  bool linearDiracKernels() const;
+  void setLag(PetscInt lag);
+
+  bool _is_linear;
+  SNES _snes;
+  Real _dt_previous;
+  unsigned int _rebuilds;
+  unsigned int _reuses;
+};
@@ -38,4 +38,6 @@ public:
   computedPermeabilitydpf(std::vector<Real> k0, Real phi0, Real porosity, Real dphi_dpf) const = 0;
   virtual std::vector<Real>
   computedPermeabilitydT(std::vector<Real> k0, Real phi0, Real porosity, Real dphi_dTs) const = 0;
+  // Whether the permeability is independent of the porosity
+  virtual bool isConstant() const { return false; }
 };
\ No newline at end of file
@@ -35,4 +35,5 @@ public:
   computedPermeabilitydpf(std::vector<Real> k0, Real phi0, Real porosity, Real dphi_dpf) const;
   std::vector<Real>
   computedPermeabilitydT(std::vector<Real> k0, Real phi0, Real porosity, Real dphi_dT) const;
+  bool isConstant() const { return true; }
 };
\ No newline at end of file
@@ -40,4 +40,6 @@ public:
   virtual Real computedPorositydev(Real phi_old, Real biot) const = 0;
   virtual Real computedPorositydpf(Real phi_old, Real biot, Real Ks) const = 0;
   virtual Real computedPorositydT(Real phi_old, Real biot, Real beta_f, Real beta_s) const = 0;
+  // Whether the porosity is independent of the deformation, pressure and temperature
+  virtual bool isConstant() const { return false; }
 };
\ No newline at end of file
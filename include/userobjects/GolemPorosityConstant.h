@@ -31,4 +31,5 @@ public:
   Real computedPorositydev(Real, Real) const;
   Real computedPorositydpf(Real, Real, Real) const;
   Real computedPorositydT(Real, Real, Real, Real) const;
+  bool isConstant() const { return true; }
 };
\ No newline at end of file
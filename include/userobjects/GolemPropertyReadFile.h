@@ -20,25 +20,45 @@
 
 #pragma once
 
-#include "GeneralUserObject.h"
+#include "GolemPropertyReader.h"
+#include "GolemMappedFile.h"
+#include "GolemFileCache.h"
 
-class GolemPropertyReadFile : public GeneralUserObject
+#include <unordered_set>
+
+/**
+ * Per-element properties read from a file, either a whitespace separated text
+ * file with one row of nprop values per element, or a binary property file
+ * (see scripts/golem_prop_to_binary.py) which is memory-mapped without parsing.
+ */
+class GolemPropertyReadFile : public GolemPropertyReader
 {
 public:
   static InputParameters validParams();
   GolemPropertyReadFile(const InputParameters & parameters);
-  virtual ~GolemPropertyReadFile() {}
-  virtual void initialize() {}
-  virtual void execute() {}
-  virtual void finalize() {}
+  virtual void meshChanged() override;
   void readData();
-  Real getData(const Elem *, unsigned int) const;
+  virtual Real getData(const Elem *, unsigned int) const override;
+  virtual void getData(const Elem * elem, std::vector<Real> & data) const override;
 
 protected:
+  // Ids of the local elements and of their point neighbors (or of all the elements of a
+  // distributed mesh present on this processor)
+  std::unordered_set<dof_id_type> neededElements() const;
+  void mapBinaryFile();
+
   std::string _prop_file_name;
   std::vector<Real> _Eledata;
-  unsigned int _nprop;
   unsigned int _nelem;
-
-private:
-};
\ No newline at end of file
+  unsigned int _chunk_size;
+  // The file is read by the first processor and scattered: only the rows of the local and
+  // ghosted elements are stored, indexed by element id
+  std::unordered_map<dof_id_type, unsigned int> _row;
+  // Binary image of the parsed text file, read instead of the file when up to date
+  const GolemFileCache _cache;
+  // Memory-mapped binary file
+  bool _binary;
+  std::unique_ptr<GolemMappedFile> _file_map;
+  const float * _float_data;
+  const double * _double_data;
+};
@@ -0,0 +1,40 @@
+/******************************************************************************/
+/*           GOLEM - Multiphysics of faulted geothermal reservoirs            */
+/*                                                                            */
+/*          Copyright (C) 2017 by Antoine B. Jacquey and Mauro Cacace         */
+/*             GFZ Potsdam, German Research Centre for Geosciences            */
+/*                                                                            */
+/*    This program is free software: you can redistribute it and/or modify    */
+/*    it under the terms of the GNU General Public License as published by    */
+/*      the Free Software Foundation, either version 3 of the License, or     */
+/*                     (at your option) any later version.                    */
+/*                                                                            */
+/*       This program is distributed in the hope that it will be useful,      */
+/*       but WITHOUT ANY WARRANTY; without even the implied warranty of       */
+/*        MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the       */
+/*                GNU General Public License for more details.                */
+/*                                                                            */
+/*      You should have received a copy of the GNU General Public License     */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/******************************************************************************/
+
+#pragma once
+
+#include "GolemPropertyReader.h"
+#include "GolemGrid.h"
+
+/**
+ * Per-element properties sampled at the element centroids from the fields of
+ * a Golem binary grid file.
+ */
+class GolemPropertyReadGrid : public GolemPropertyReader
+{
+public:
+  static InputParameters validParams();
+  GolemPropertyReadGrid(const InputParameters & parameters);
+  virtual Real getData(const Elem * elem, unsigned int prop_num) const override;
+  virtual void getData(const Elem * elem, std::vector<Real> & data) const override;
+
+protected:
+  const GolemGrid _grid;
+};
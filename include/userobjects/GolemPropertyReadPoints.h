@@ -0,0 +1,58 @@
+/******************************************************************************/
+/*           GOLEM - Multiphysics of faulted geothermal reservoirs            */
+/*                                                                            */
+/*          Copyright (C) 2017 by Antoine B. Jacquey and Mauro Cacace         */
+/*             GFZ Potsdam, German Research Centre for Geosciences            */
+/*                                                                            */
+/*    This program is free software: you can redistribute it and/or modify    */
+/*    it under the terms of the GNU General Public License as published by    */
+/*      the Free Software Foundation, either version 3 of the License, or     */
+/*                     (at your option) any later version.                    */
+/*                                                                            */
+/*       This program is distributed in the hope that it will be useful,      */
+/*       but WITHOUT ANY WARRANTY; without even the implied warranty of       */
+/*        MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the       */
+/*                GNU General Public License for more details.                */
+/*                                                                            */
+/*      You should have received a copy of the GNU General Public License     */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/******************************************************************************/
+
+#pragma once
+
+#include "GolemPropertyReader.h"
+#include "KDTree.h"
+
+/**
+ * Per-element properties interpolated from scattered samples (one row
+ * "x y z value_1 ... value_nprop" per sample). The samples are stored in a
+ * KD-tree and each local element gets the inverse distance weighted average
+ * of the samples nearest to its centroid, computed once per element. The
+ * properties therefore do not depend on the element numbering and follow
+ * remeshing and adaptivity.
+ */
+class GolemPropertyReadPoints : public GolemPropertyReader
+{
+public:
+  static InputParameters validParams();
+  GolemPropertyReadPoints(const InputParameters & parameters);
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+  virtual Real getData(const Elem * elem, unsigned int prop_num) const override;
+  virtual void getData(const Elem * elem, std::vector<Real> & data) const override;
+
+protected:
+  void readPoints();
+  void assignElements();
+  const Real * elementData(const Elem * elem) const;
+
+  const FileName _points_file_name;
+  const unsigned int _num_neighbors;
+  const Real _power;
+  std::vector<Point> _points;
+  std::vector<Real> _values;
+  std::unique_ptr<KDTree> _kd_tree;
+  // Properties of the local elements, indexed by element id
+  std::unordered_map<dof_id_type, unsigned int> _row;
+  std::vector<Real> _Eledata;
+};
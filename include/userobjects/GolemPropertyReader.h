@@ -0,0 +1,48 @@
+/******************************************************************************/
+/*           GOLEM - Multiphysics of faulted geothermal reservoirs            */
+/*                                                                            */
+/*          Copyright (C) 2017 by Antoine B. Jacquey and Mauro Cacace         */
+/*             GFZ Potsdam, German Research Centre for Geosciences            */
+/*                                                                            */
+/*    This program is free software: you can redistribute it and/or modify    */
+/*    it under the terms of the GNU General Public License as published by    */
+/*      the Free Software Foundation, either version 3 of the License, or     */
+/*                     (at your option) any later version.                    */
+/*                                                                            */
+/*       This program is distributed in the hope that it will be useful,      */
+/*       but WITHOUT ANY WARRANTY; without even the implied warranty of       */
+/*        MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the       */
+/*                GNU General Public License for more details.                */
+/*                                                                            */
+/*      You should have received a copy of the GNU General Public License     */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/******************************************************************************/
+
+#pragma once
+
+#include "GeneralUserObject.h"
+
+/**
+ * Golem base class for user objects providing per-element property values
+ * read from external data. Override the virtual functions in your class.
+ */
+class GolemPropertyReader : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+  GolemPropertyReader(const InputParameters & parameters);
+  virtual void initialize() {}
+  virtual void execute() {}
+  virtual void finalize() {}
+  virtual Real getData(const Elem * elem, unsigned int prop_num) const = 0;
+  // All the properties of an element in one lookup
+  virtual void getData(const Elem * elem, std::vector<Real> & data) const = 0;
+  unsigned int nProperties() const { return _nprop; }
+  bool hasPropertyNames() const { return !_prop_names.empty(); }
+  // Column of a property in the data
+  unsigned int propertyIndex(const std::string & name) const;
+
+protected:
+  unsigned int _nprop;
+  std::vector<std::string> _prop_names;
+};
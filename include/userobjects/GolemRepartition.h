@@ -0,0 +1,57 @@
+/******************************************************************************/
+/*           GOLEM - Multiphysics of faulted geothermal reservoirs            */
+/*                                                                            */
+/*          Copyright (C) 2017 by Antoine B. Jacquey and Mauro Cacace         */
+/*             GFZ Potsdam, German Research Centre for Geosciences            */
+/*                                                                            */
+/*    This program is free software: you can redistribute it and/or modify    */
+/*    it under the terms of the GNU General Public License as published by    */
+/*      the Free Software Foundation, either version 3 of the License, or     */
+/*                     (at your option) any later version.                    */
+/*                                                                            */
+/*       This program is distributed in the hope that it will be useful,      */
+/*       but WITHOUT ANY WARRANTY; without even the implied warranty of       */
+/*        MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the       */
+/*                GNU General Public License for more details.                */
+/*                                                                            */
+/*      You should have received a copy of the GNU General Public License     */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/******************************************************************************/
+
+#pragma once
+
+#include "ElementUserObject.h"
+
+class GolemPartitioner;
+
+/**
+ * Measures the return-map iterations per element and repartitions the mesh
+ * with GolemPartitioner every given number of time steps. The repartition is
+ * done at the setup of the next time step, before any object is executed on
+ * the new partition. The load imbalance (maximum over mean cost per
+ * processor) is reported before and after.
+ */
+class GolemRepartition : public ElementUserObject
+{
+public:
+  static InputParameters validParams();
+  GolemRepartition(const InputParameters & parameters);
+  virtual void initialSetup() override;
+  virtual void timestepSetup() override;
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+
+protected:
+  Real imbalance() const;
+
+  const unsigned int _interval;
+  const MaterialProperty<Real> * _return_map_iterations;
+  GolemPartitioner * _partitioner;
+  // Sum over the time steps of the mean iterations per quadrature point, by element id
+  std::map<dof_id_type, Real> _iterations;
+  unsigned int _n_steps;
+  // Whether the next time step starts with a repartition
+  bool _repartition;
+};
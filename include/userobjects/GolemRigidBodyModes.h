@@ -0,0 +1,63 @@
+/******************************************************************************/
+/*           GOLEM - Multiphysics of faulted geothermal reservoirs            */
+/*                                                                            */
+/*          Copyright (C) 2017 by Antoine B. Jacquey and Mauro Cacace         */
+/*             GFZ Potsdam, German Research Centre for Geosciences            */
+/*                                                                            */
+/*    This program is free software: you can redistribute it and/or modify    */
+/*    it under the terms of the GNU General Public License as published by    */
+/*      the Free Software Foundation, either version 3 of the License, or     */
+/*                     (at your option) any later version.                    */
+/*                                                                            */
+/*       This program is distributed in the hope that it will be useful,      */
+/*       but WITHOUT ANY WARRANTY; without even the implied warranty of       */
+/*        MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the       */
+/*                GNU General Public License for more details.                */
+/*                                                                            */
+/*      You should have received a copy of the GNU General Public License     */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/******************************************************************************/
+
+#pragma once
+
+#include "NodalUserObject.h"
+
+#include <petscksp.h>
+
+/**
+ * Fills the NearNullSpace vectors of the nonlinear system with the rigid body
+ * modes of the displacement field (translations and rotations) built from the
+ * node coordinates. The modes are attached to the Jacobian for algebraic
+ * multigrid and, when a fieldsplit preconditioner is used, restricted to the
+ * split(s) holding the displacement variables. They are rebuilt when the mesh
+ * changes (e.g. after a repartition, which renumbers the dofs).
+ */
+class GolemRigidBodyModes : public NodalUserObject
+{
+public:
+  static InputParameters validParams();
+  GolemRigidBodyModes(const InputParameters & parameters);
+  virtual void initialize();
+  virtual void execute();
+  virtual void threadJoin(const UserObject & y);
+  virtual void finalize();
+  virtual void meshChanged() override;
+  unsigned int numModes() const { return _nmodes; }
+
+protected:
+  void addNode(const Node & node);
+  void reportJacobian(KSP ksp);
+  void attachToFieldSplit(PC pc);
+  static PetscErrorCode preSolve(KSP ksp, Vec rhs, Vec x, void * ctx);
+
+  unsigned int _ndisp;
+  unsigned int _nmodes;
+  std::vector<unsigned int> _disp_var;
+  unsigned int _sys_num;
+  bool _attach_to_fieldsplit;
+  bool _presolve_set;
+  bool _jacobian_reported;
+  // Local dofs and the values of each mode at these dofs
+  std::vector<dof_id_type> _dofs;
+  std::vector<std::vector<Real>> _values;
+};
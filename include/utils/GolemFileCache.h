@@ -0,0 +1,100 @@
+/******************************************************************************/
+/*           GOLEM - Multiphysics of faulted geothermal reservoirs            */
+/*                                                                            */
+/*          Copyright (C) 2017 by Antoine B. Jacquey and Mauro Cacace         */
+/*             GFZ Potsdam, German Research Centre for Geosciences            */
+/*                                                                            */
+/*    This program is free software: you can redistribute it and/or modify    */
+/*    it under the terms of the GNU General Public License as published by    */
+/*      the Free Software Foundation, either version 3 of the License, or     */
+/*                     (at your option) any later version.                    */
+/*                                                                            */
+/*       This program is distributed in the hope that it will be useful,      */
+/*       but WITHOUT ANY WARRANTY; without even the implied warranty of       */
+/*        MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the       */
+/*                GNU General Public License for more details.                */
+/*                                                                            */
+/*      You should have received a copy of the GNU General Public License     */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/******************************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <atomic>
+#include <fstream>
+
+/**
+ * Opt-in on-disk cache of parsed text data files. The arrays parsed from a
+ * file are written to a binary image in the cache directory, named after the
+ * absolute path of the file. The image is reused while the size and the
+ * modification time of the file are unchanged and, when verifying, while the
+ * hash of its content matches.
+ */
+class GolemFileCache
+{
+public:
+  // An empty directory disables the cache
+  GolemFileCache(const std::string & directory = "", bool verify = false);
+  bool enabled() const { return !_directory.empty(); }
+  // Arrays of a valid image of the file parsed with the given options (tag)
+  bool load(const std::string & file_name,
+            const std::string & tag,
+            std::vector<std::vector<Real>> & arrays) const;
+  void store(const std::string & file_name,
+             const std::string & tag,
+             const std::vector<std::vector<Real>> & arrays) const;
+  std::string summary() const;
+
+  /// Image read piece by piece, for the arrays too large to be held at once
+  class Reader
+  {
+  public:
+    Reader(const GolemFileCache & cache, const std::string & file_name, const std::string & tag);
+    // Whether the image is valid for the file (counted as a hit, a miss or stale)
+    bool valid() const { return _valid; }
+    const std::vector<uint64_t> & lengths() const { return _lengths; }
+    // Next n values of the arrays, one after the other
+    void read(Real * values, std::size_t n);
+
+  protected:
+    std::string _image_name;
+    std::ifstream _image;
+    std::vector<uint64_t> _lengths;
+    bool _valid;
+  };
+
+  /// Image written piece by piece, put in place by commit() and discarded otherwise
+  class Writer
+  {
+  public:
+    Writer(const GolemFileCache & cache,
+           const std::string & file_name,
+           const std::string & tag,
+           const std::vector<uint64_t> & lengths);
+    ~Writer();
+    // Next n values of the arrays, one after the other
+    void write(const Real * values, std::size_t n);
+    bool commit();
+
+  protected:
+    const GolemFileCache & _cache;
+    std::string _image_name;
+    std::string _tmp_name;
+    std::ofstream _image;
+    uint64_t _remaining;
+  };
+
+protected:
+  std::string imageName(const std::string & file_name, const std::string & tag) const;
+  uint64_t contentHash(const std::string & file_name) const;
+
+  const std::string _directory;
+  const bool _verify;
+  // Loads and stores may run on a prefetching thread
+  mutable std::atomic<unsigned int> _hits;
+  mutable std::atomic<unsigned int> _misses;
+  mutable std::atomic<unsigned int> _stale;
+  mutable std::atomic<unsigned int> _written;
+};
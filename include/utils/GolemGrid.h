@@ -0,0 +1,52 @@
+/******************************************************************************/
+/*           GOLEM - Multiphysics of faulted geothermal reservoirs            */
+/*                                                                            */
+/*          Copyright (C) 2017 by Antoine B. Jacquey and Mauro Cacace         */
+/*             GFZ Potsdam, German Research Centre for Geosciences            */
+/*                                                                            */
+/*    This program is free software: you can redistribute it and/or modify    */
+/*    it under the terms of the GNU General Public License as published by    */
+/*      the Free Software Foundation, either version 3 of the License, or     */
+/*                     (at your option) any later version.                    */
+/*                                                                            */
+/*       This program is distributed in the hope that it will be useful,      */
+/*       but WITHOUT ANY WARRANTY; without even the implied warranty of       */
+/*        MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the       */
+/*                GNU General Public License for more details.                */
+/*                                                                            */
+/*      You should have received a copy of the GNU General Public License     */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/******************************************************************************/
+
+#pragma once
+
+#include "GolemMappedFile.h"
+#include "libmesh/point.h"
+
+/**
+ * Fields given on a regular 3D grid, read from a memory-mapped Golem binary
+ * grid file (see scripts/golem_grid_to_binary.py) and sampled by trilinear
+ * interpolation. Points outside the grid take the value of the closest face.
+ */
+class GolemGrid
+{
+public:
+  GolemGrid(const Parallel::Communicator & comm,
+            const std::string & file_name,
+            bool verify_checksum = true);
+  unsigned int nFields() const { return _field_names.size(); }
+  const std::vector<std::string> & fieldNames() const { return _field_names; }
+  unsigned int fieldIndex(const std::string & name) const;
+  Real value(const Point & p, unsigned int field) const;
+
+protected:
+  Real gridValue(std::size_t i, std::size_t j, std::size_t k, unsigned int field) const;
+
+  GolemMappedFile _file;
+  Point _origin;
+  RealVectorValue _spacing;
+  std::size_t _n[3];
+  std::vector<std::string> _field_names;
+  const float * _float_data;
+  const double * _double_data;
+};
@@ -23,4 +23,12 @@
 #include "MooseTypes.h"
 #include "RankTwoTensor.h"
 
-RankTwoTensor computeKernel(std::vector<Real>, MooseEnum, Real, int dim);
\ No newline at end of file
+/**
+ * Permeability tensor (times den) from the input values k0 for a given distribution
+ * (isotropic, orthotropic, anisotropic). Only the first dim rows and columns are filled.
+ */
+template <unsigned int dim>
+RankTwoTensor computeKernel(const std::vector<Real> & k0, const MooseEnum & dist, Real den);
+
+RankTwoTensor
+computeKernel(const std::vector<Real> & k0, const MooseEnum & dist, Real den, int dim);
@@ -22,6 +22,12 @@
 
 #include "MooseTypes.h"
 #include "ColumnMajorMatrix.h"
+#include "GolemTimeSeries.h"
+#include "KDTree.h"
+
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
 
 class GolemInterpolateBCFromFile
 {
@@ -31,23 +37,64 @@ public:
                              const std::vector<std::string> & file_names,
                              const ColumnMajorMatrix & px,
                              const ColumnMajorMatrix & py,
-                             const ColumnMajorMatrix & pv);
+                             const ColumnMajorMatrix & pv,
+                             unsigned int num_neighbors = 0,
+                             Real power = 4.0);
   GolemInterpolateBCFromFile()
-    : _n_points(0), _time_frames(std::vector<Real>()), _file_names(std::vector<std::string>())
+    : _n_points(0),
+      _time_frames(std::vector<Real>()),
+      _file_names(std::vector<std::string>()),
+      _num_neighbors(0),
+      _power(4.0),
+      _same_points(true)
   {
   }
-  Real sample(Real t, Real xcoord, Real ycoord);
-  Real sampleTime(Real t, Real xcoord, Real ycoord);
+  Real sample(Real t, Real xcoord, Real ycoord) const;
+  Real sampleTime(Real t, Real xcoord, Real ycoord) const;
 
 protected:
   const unsigned int _n_points;
   const std::vector<Real> _time_frames;
+  // Lookup of the time frame holding the sampled time
+  const GolemTimeSeries _time_series;
   const std::vector<std::string> _file_names;
   ColumnMajorMatrix _px;
   ColumnMajorMatrix _py;
   ColumnMajorMatrix _pv;
+  // Number of points used by the inverse distance weighting (0 for all the points)
+  const unsigned int _num_neighbors;
+  const Real _power;
+  // Whether all the time frames hold the same points (in the same order)
+  bool _same_points;
+
+  // Points of a time frame and their weights for a sampling location
+  struct Stencil
+  {
+    std::vector<unsigned int> index;
+    std::vector<Real> weight;
+  };
+  struct PointHash
+  {
+    std::size_t operator()(const std::pair<Real, Real> & p) const
+    {
+      return std::hash<Real>()(p.first) ^ (std::hash<Real>()(p.second) << 1);
+    }
+  };
+  // Per time frame: points, KD-tree and stencils of the sampled locations. The stencils are
+  // keyed by the sampled coordinates, which repeat from one time step to the next as long as the
+  // mesh does not move. At most max_stencils are kept per frame; the locations sampled beyond
+  // that (e.g. on a displaced mesh) get their stencil recomputed on each call.
+  static const std::size_t max_stencils;
+  std::vector<std::vector<Point>> _points;
+  std::vector<std::unique_ptr<KDTree>> _kd_trees;
+  mutable std::vector<std::unordered_map<std::pair<Real, Real>, Stencil, PointHash>> _stencils;
+  mutable std::shared_mutex _stencils_mutex;
 
 private:
   void errorCheck();
-  Real interpolate_values(int, Real, Real);
+  void buildKDTrees();
+  void computeStencil(unsigned int frame, Real xcoord, Real ycoord, Stencil & result) const;
+  Real stencil_value(int pos, const Stencil & s) const;
+  Real interpolate_values(int, Real, Real) const;
+  Real interpolate_all_values(int, Real, Real) const;
 };
\ No newline at end of file
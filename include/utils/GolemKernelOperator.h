@@ -0,0 +1,181 @@
+/******************************************************************************/
+/*           GOLEM - Multiphysics of faulted geothermal reservoirs            */
+/*                                                                            */
+/*          Copyright (C) 2017 by Antoine B. Jacquey and Mauro Cacace         */
+/*             GFZ Potsdam, German Research Centre for Geosciences            */
+/*                                                                            */
+/*    This program is free software: you can redistribute it and/or modify    */
+/*    it under the terms of the GNU General Public License as published by    */
+/*      the Free Software Foundation, either version 3 of the License, or     */
+/*                     (at your option) any later version.                    */
+/*                                                                            */
+/*       This program is distributed in the hope that it will be useful,      */
+/*       but WITHOUT ANY WARRANTY; without even the implied warranty of       */
+/*        MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the       */
+/*                GNU General Public License for more details.                */
+/*                                                                            */
+/*      You should have received a copy of the GNU General Public License     */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/******************************************************************************/
+
+#pragma once
+
+#include "GolemElementMatrixCache.h"
+#include "GolemSumFactorization.h"
+
+/**
+ * Assembly shared by the linear diffusion kernels: on blocks with constant properties the
+ * element matrices (and constant load vectors) are taken from a GolemElementMatrixCache
+ * instead of the quadrature loops. The residual is then extrapolated from the cached element
+ * matrix, which only holds for kernels declaring a residual affine in their variable with an
+ * exact Jacobian (affineResidual()). In matrix-free mode, the residual of axis aligned HEX8
+ * elements is computed by sum factorization from the flux and the source supplied by the
+ * kernel, and only the diagonal of the Jacobian is assembled. The gradients at the quadrature
+ * points are interpolated from the nodal values by the same 1D factors.
+ */
+template <typename T>
+class GolemKernelOperator : public T
+{
+public:
+  static InputParameters validParams();
+  GolemKernelOperator(const InputParameters & parameters);
+
+protected:
+  virtual void initialSetup() override;
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  // Whether, on blocks with constant properties, the residual is affine in the variable and
+  // computeJacobian() returns its exact derivative, i.e. whether it can be cached
+  virtual bool affineResidual() const = 0;
+  // Flux (tested against the test function gradients) and source (tested against the test
+  // functions) at the current quadrature point for the variable gradient grad_u, without
+  // quadrature weight
+  virtual void
+  computeQpFluxSource(const RealVectorValue & grad_u, RealVectorValue & flux, Real & source) = 0;
+
+  bool _matrix_free;
+  const GolemElementMatrixCache * _cache;
+  unsigned int _cache_index;
+};
+
+template <typename T>
+InputParameters
+GolemKernelOperator<T>::validParams()
+{
+  InputParameters params = T::validParams();
+  params.addParam<bool>(
+      "matrix_free",
+      false,
+      "Apply the operator with sum factorization on axis aligned HEX8 elements and only "
+      "assemble the diagonal of the Jacobian (to be used with JFNK and a Jacobi preconditioner).");
+  params.addParam<UserObjectName>(
+      "element_matrix_cache",
+      "The GolemElementMatrixCache storing the element matrices on blocks whose materials have "
+      "constant properties (constant porosity, permeability, fluid density and viscosity). Only "
+      "kernels with a residual affine in their variable accept it.");
+  return params;
+}
+
+template <typename T>
+GolemKernelOperator<T>::GolemKernelOperator(const InputParameters & parameters)
+  : T(parameters),
+    _matrix_free(this->template getParam<bool>("matrix_free")),
+    _cache(this->isParamValid("element_matrix_cache")
+               ? &this->template getUserObject<GolemElementMatrixCache>("element_matrix_cache")
+               : NULL),
+    _cache_index(_cache ? _cache->kernelIndex(this->name()) : 0)
+{
+  if (_matrix_free && _cache)
+    mooseError(this->type(), ": matrix_free and element_matrix_cache cannot be used together.");
+}
+
+template <typename T>
+void
+GolemKernelOperator<T>::initialSetup()
+{
+  T::initialSetup();
+  if (_cache && !affineResidual())
+    mooseError(this->type(),
+               ": the element matrix cache requires a residual affine in '",
+               this->_var.name(),
+               "', which this kernel does not provide with the current parameters.");
+}
+
+template <typename T>
+void
+GolemKernelOperator<T>::computeResidual()
+{
+  RealVectorValue h;
+  if (_matrix_free && this->_var.dofValues().size() == 8 &&
+      GolemSumFactorization::isAxisAlignedHex8(this->_current_elem, this->_qrule, h))
+  {
+    this->prepareVectorTag(this->_assembly, this->_var.number());
+    const unsigned int nqp = this->_qrule->n_points();
+    Real u[8];
+    for (unsigned int i = 0; i < 8; ++i)
+      u[i] = this->_var.dofValues()[i];
+    std::vector<RealVectorValue> grad_u;
+    GolemSumFactorization::gradient(h, u, grad_u);
+    const Real JxW = GolemSumFactorization::weight(h);
+    std::vector<RealVectorValue> flux(nqp);
+    std::vector<Real> source(nqp, 0.0);
+    for (this->_qp = 0; this->_qp < nqp; ++this->_qp)
+    {
+      const unsigned int qp = this->_qp;
+      computeQpFluxSource(grad_u[qp], flux[qp], source[qp]);
+      const Real w = JxW * this->_coord[qp];
+      flux[qp] *= w;
+      source[qp] *= w;
+    }
+    GolemSumFactorization::integrate(h, flux, source, this->_local_re);
+    this->accumulateTaggedLocalResidual();
+    return;
+  }
+
+  GolemElementMatrixCache::Entry * entry =
+      _cache ? _cache->find(_cache_index, this->_current_elem, this->_tid) : NULL;
+  if (!entry || !entry->has_re)
+  {
+    T::computeResidual();
+    if (entry)
+      _cache->insertResidual(*entry, this->_local_re, this->_var.dofValues());
+    return;
+  }
+  this->prepareVectorTag(this->_assembly, this->_var.number());
+  _cache->residual(*entry, this->_var.dofValues(), this->_local_re);
+  this->accumulateTaggedLocalResidual();
+}
+
+template <typename T>
+void
+GolemKernelOperator<T>::computeJacobian()
+{
+  if (_matrix_free)
+  {
+    // Diagonal only, used to precondition the matrix-free operator
+    this->prepareMatrixTag(this->_assembly, this->_var.number(), this->_var.number());
+    this->precalculateJacobian();
+    for (this->_i = 0; this->_i < this->_test.size(); this->_i++)
+      for (this->_qp = 0; this->_qp < this->_qrule->n_points(); this->_qp++)
+      {
+        this->_j = this->_i;
+        this->_local_ke(this->_i, this->_i) +=
+            this->_JxW[this->_qp] * this->_coord[this->_qp] * this->computeQpJacobian();
+      }
+    this->accumulateTaggedLocalMatrix();
+    return;
+  }
+
+  GolemElementMatrixCache::Entry * entry =
+      _cache ? _cache->find(_cache_index, this->_current_elem, this->_tid) : NULL;
+  if (!entry)
+  {
+    T::computeJacobian();
+    if (_cache)
+      _cache->insert(_cache_index, this->_current_elem, this->_local_ke, this->_tid);
+    return;
+  }
+  this->prepareMatrixTag(this->_assembly, this->_var.number(), this->_var.number());
+  this->_local_ke = entry->ke;
+  this->accumulateTaggedLocalMatrix();
+}
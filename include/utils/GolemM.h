@@ -20,6 +20,10 @@
 
 #pragma once
 
+#include "MooseTypes.h"
+#include "RankTwoTensor.h"
+#include "RankFourTensor.h"
+
 namespace GolemM
 {
 
@@ -33,6 +37,55 @@ Real elasticJacobian(const RankFourTensor & r4t,
                      const RealGradient & grad_test,
                      const RealGradient & grad_phi);
 
+/**
+ * Same as above, restricted to the first dim components of the gradients (the remaining
+ * components being zero in 1D and 2D).
+ */
+template <unsigned int dim>
+Real
+elasticJacobian(const RankFourTensor & r4t,
+                unsigned int i,
+                unsigned int k,
+                const RealGradient & grad_test,
+                const RealGradient & grad_phi)
+{
+  Real sum = 0.0;
+  for (unsigned int j = 0; j < dim; ++j)
+    for (unsigned int l = 0; l < dim; ++l)
+      sum += r4t(i, j, k, l) * grad_phi(l) * grad_test(j);
+  return sum;
+}
+
+/**
+ * Displacement gradient tensor du_i/dx_j built from the first dim displacement components
+ */
+template <unsigned int dim>
+RankTwoTensor
+displacementGradient(const std::vector<const VariableGradient *> & grad_disp, unsigned int qp)
+{
+  RankTwoTensor A;
+  for (unsigned int i = 0; i < dim; ++i)
+    for (unsigned int j = 0; j < dim; ++j)
+      A(i, j) = (*grad_disp[i])[qp](j);
+  return A;
+}
+
+/**
+ * Stress C_ijkl * strain_kl for a strain without out-of-plane components (k, l < dim)
+ */
+template <unsigned int dim>
+RankTwoTensor
+elasticStress(const RankFourTensor & C, const RankTwoTensor & strain)
+{
+  RankTwoTensor stress;
+  for (unsigned int i = 0; i < 3; ++i)
+    for (unsigned int j = 0; j < 3; ++j)
+      for (unsigned int k = 0; k < dim; ++k)
+        for (unsigned int l = 0; l < dim; ++l)
+          stress(i, j) += C(i, j, k, l) * strain(k, l);
+  return stress;
+}
+
 /**
  * Get the shear modulus for an isotropic elasticity tensor
  * param elasticity_tensor the tensor (must be isotropic, but not checked for efficiency)
@@ -0,0 +1,57 @@
+/******************************************************************************/
+/*           GOLEM - Multiphysics of faulted geothermal reservoirs            */
+/*                                                                            */
+/*          Copyright (C) 2017 by Antoine B. Jacquey and Mauro Cacace         */
+/*             GFZ Potsdam, German Research Centre for Geosciences            */
+/*                                                                            */
+/*    This program is free software: you can redistribute it and/or modify    */
+/*    it under the terms of the GNU General Public License as published by    */
+/*      the Free Software Foundation, either version 3 of the License, or     */
+/*                     (at your option) any later version.                    */
+/*                                                                            */
+/*       This program is distributed in the hope that it will be useful,      */
+/*       but WITHOUT ANY WARRANTY; without even the implied warranty of       */
+/*        MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the       */
+/*                GNU General Public License for more details.                */
+/*                                                                            */
+/*      You should have received a copy of the GNU General Public License     */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/******************************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "libmesh/communicator.h"
+
+/**
+ * Read-only memory map of a Golem binary file. The binary formats start with
+ * an 8 character magic and store property names as zero padded strings of
+ * name_size characters.
+ */
+class GolemMappedFile
+{
+public:
+  GolemMappedFile(const std::string & file_name);
+  ~GolemMappedFile();
+  GolemMappedFile(const GolemMappedFile &) = delete;
+  GolemMappedFile & operator=(const GolemMappedFile &) = delete;
+  const char * data() const { return _data; }
+  std::size_t size() const { return _size; }
+  // Error if the file is shorter than the given size
+  void checkSize(std::size_t size) const;
+  std::vector<std::string> names(std::size_t offset, unsigned int n) const;
+  static bool hasMagic(const std::string & file_name, const char * magic);
+  // FNV-1a 64 bits hash
+  static uint64_t checksum(const char * data, std::size_t size);
+  // Checksum verified by the first processor only, the result is broadcast to the others
+  static bool verifyChecksum(const Parallel::Communicator & comm,
+                             const char * data,
+                             std::size_t size,
+                             uint64_t expected);
+  static const std::size_t name_size = 32;
+
+protected:
+  const std::string _file_name;
+  const char * _data;
+  std::size_t _size;
+};
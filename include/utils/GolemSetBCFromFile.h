@@ -22,6 +22,9 @@
 
 #include "MooseTypes.h"
 #include "ColumnMajorMatrix.h"
+#include "GolemTimeSeries.h"
+
+#include <unordered_map>
 
 class GolemSetBCFromFile
 {
@@ -33,21 +36,35 @@ public:
                      const ColumnMajorMatrix & py,
                      const ColumnMajorMatrix & pv);
   GolemSetBCFromFile()
-    : _n_points(0), _time_frames(std::vector<Real>()), _file_names(std::vector<std::string>())
+    : _n_points(0),
+      _time_frames(std::vector<Real>()),
+      _file_names(std::vector<std::string>()),
+      _same_points(true)
   {
   }
-  Real sample(Real t, Real xcoord, Real ycoord);
-  Real sampleTime(Real t, Real xcoord, Real ycoord);
+  Real sample(Real t, Real xcoord, Real ycoord) const;
+  Real sampleTime(Real t, Real xcoord, Real ycoord) const;
 
 protected:
   const unsigned int _n_points;
   const std::vector<Real> _time_frames;
+  // Lookup of the time frame holding the sampled time
+  const GolemTimeSeries _time_series;
   const std::vector<std::string> _file_names;
   ColumnMajorMatrix _px;
   ColumnMajorMatrix _py;
   ColumnMajorMatrix _pv;
+  // Whether all the time frames hold the same points (in the same order)
+  bool _same_points;
+  // Per time frame, points by bucket of a uniform grid with the size of the tolerance
+  std::vector<std::unordered_map<uint64_t, std::vector<unsigned int>>> _buckets;
 
 private:
   void errorCheck();
-  Real find_value(int posi, Real xcoord, Real ycoord);
+  void buildIndex();
+  // Index of the first point of the time frame matching the coordinates
+  unsigned int find_index(int posi, Real xcoord, Real ycoord) const;
+  Real find_value(int posi, Real xcoord, Real ycoord) const;
+  // Value of the i-th point of the time frame, error if no point was found
+  Real value_at(int posi, unsigned int i, Real xcoord, Real ycoord) const;
 };
\ No newline at end of file
@@ -0,0 +1,63 @@
+/******************************************************************************/
+/*           GOLEM - Multiphysics of faulted geothermal reservoirs            */
+/*                                                                            */
+/*          Copyright (C) 2017 by Antoine B. Jacquey and Mauro Cacace         */
+/*             GFZ Potsdam, German Research Centre for Geosciences            */
+/*                                                                            */
+/*    This program is free software: you can redistribute it and/or modify    */
+/*    it under the terms of the GNU General Public License as published by    */
+/*      the Free Software Foundation, either version 3 of the License, or     */
+/*                     (at your option) any later version.                    */
+/*                                                                            */
+/*       This program is distributed in the hope that it will be useful,      */
+/*       but WITHOUT ANY WARRANTY; without even the implied warranty of       */
+/*        MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the       */
+/*                GNU General Public License for more details.                */
+/*                                                                            */
+/*      You should have received a copy of the GNU General Public License     */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/******************************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "libmesh/dense_vector.h"
+
+namespace libMesh
+{
+class Elem;
+class QBase;
+}
+
+namespace GolemSumFactorization
+{
+
+/**
+ * Check that the element is a HEX8 with edges along the coordinate axes integrated with
+ * a 2x2x2 tensor Gauss rule. Returns the (signed) element sizes in h.
+ */
+bool isAxisAlignedHex8(const Elem * elem, const QBase * qrule, RealVectorValue & h);
+
+/**
+ * Sum-factorized interpolation of the gradient at the 2x2x2 Gauss points of an axis aligned
+ * HEX8 from the nodal values u (local dof ordering), without the finite element reinit.
+ */
+void gradient(const RealVectorValue & h, const Real u[8], std::vector<RealVectorValue> & grad);
+
+/**
+ * Quadrature weight times Jacobian (JxW), the same at the 2x2x2 Gauss points of an axis
+ * aligned HEX8.
+ */
+Real weight(const RealVectorValue & h);
+
+/**
+ * Sum-factorized integration of flux * grad(test) + source * test over an axis aligned
+ * HEX8, flux and source being given at the quadrature points and already weighted by JxW.
+ * The result is added to re (local dof ordering).
+ */
+void integrate(const RealVectorValue & h,
+               const std::vector<RealVectorValue> & flux,
+               const std::vector<Real> & source,
+               DenseVector<Number> & re);
+
+} // namespace GolemSumFactorization
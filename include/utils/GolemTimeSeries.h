@@ -0,0 +1,95 @@
+/******************************************************************************/
+/*           GOLEM - Multiphysics of faulted geothermal reservoirs            */
+/*                                                                            */
+/*          Copyright (C) 2017 by Antoine B. Jacquey and Mauro Cacace         */
+/*             GFZ Potsdam, German Research Centre for Geosciences            */
+/*                                                                            */
+/*    This program is free software: you can redistribute it and/or modify    */
+/*    it under the terms of the GNU General Public License as published by    */
+/*      the Free Software Foundation, either version 3 of the License, or     */
+/*                     (at your option) any later version.                    */
+/*                                                                            */
+/*       This program is distributed in the hope that it will be useful,      */
+/*       but WITHOUT ANY WARRANTY; without even the implied warranty of       */
+/*        MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the       */
+/*                GNU General Public License for more details.                */
+/*                                                                            */
+/*      You should have received a copy of the GNU General Public License     */
+/*    along with this program.  If not, see <http://www.gnu.org/licenses/>    */
+/******************************************************************************/
+
+#pragma once
+
+#include "GolemFileCache.h"
+#include "MooseTypes.h"
+#include "libmesh/communicator.h"
+
+#include <atomic>
+#include <limits>
+
+/**
+ * Values given at increasing times, possibly in several columns. The interval
+ * holding a time is found by binary search, starting from the interval of the
+ * last lookup. Lookups outside of the times are only counted, see outside().
+ */
+class GolemTimeSeries
+{
+public:
+  enum class Extrapolation
+  {
+    ZERO,
+    CONSTANT,
+    LINEAR
+  };
+
+  GolemTimeSeries(const std::vector<Real> & time = std::vector<Real>(),
+                  const std::vector<std::vector<Real>> & columns = std::vector<std::vector<Real>>(),
+                  Extrapolation before = Extrapolation::CONSTANT,
+                  Extrapolation after = Extrapolation::CONSTANT);
+  // Reads a time column followed by value columns (space, tab or comma separated, # comments).
+  // The file is parsed on rank 0 (or loaded from the cache) and broadcast.
+  GolemTimeSeries(const std::string & file_name,
+                  Extrapolation before,
+                  Extrapolation after,
+                  const Parallel::Communicator & comm,
+                  const GolemFileCache * cache = NULL);
+
+  std::size_t size() const { return _time.size(); }
+  unsigned int nColumns() const { return _columns.size(); }
+  const std::vector<Real> & times() const { return _time; }
+  // Index of the last time not after t (0 before the first time)
+  unsigned int index(Real t) const;
+  // Linear interpolation in time of a column
+  Real value(Real t, unsigned int column = 0) const;
+  // Value of a column at the last time not after t
+  Real stepValue(Real t, unsigned int column = 0) const;
+  // Lookups outside of the times, to combine over the threads and the ranks before the report
+  struct Outside
+  {
+    unsigned long n_before = 0;
+    unsigned long n_after = 0;
+    Real min_time = std::numeric_limits<Real>::max();
+    Real max_time = std::numeric_limits<Real>::lowest();
+    void merge(const Outside & other);
+    void reduce(const Parallel::Communicator & comm);
+  };
+  Outside outside() const;
+  // Report of the lookups outside of the times (empty if there were none)
+  std::string summary(const Outside & outside) const;
+
+protected:
+  void readFile(const std::string & file_name, const GolemFileCache * cache);
+  void check(const std::string & origin) const;
+  Real extrapolate(Real t, unsigned int column) const;
+  void countOutside(Real t) const;
+
+  std::vector<Real> _time;
+  std::vector<std::vector<Real>> _columns;
+  const Extrapolation _before;
+  const Extrapolation _after;
+  mutable std::atomic<unsigned int> _cursor;
+  mutable std::atomic<unsigned long> _n_before;
+  mutable std::atomic<unsigned long> _n_after;
+  mutable std::atomic<Real> _min_time;
+  mutable std::atomic<Real> _max_time;
+};
@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+"""Convert fields given on a regular grid as text rows 'x y z value_1 ... value_n'
+(in any order) into the Golem binary grid format.
+
+Layout (little endian):
+  magic 'GOLEMGRD', uint32 version (1), uint32 dtype (4: float32, 8: float64),
+  uint32 nx, ny, nz, uint32 nvar, float64 origin[3], float64 spacing[3],
+  uint64 FNV-1a checksum of the values, nvar field names of 32 bytes (zero padded),
+  values of each field with the x index running fastest.
+"""
+
+import argparse
+import array
+import struct
+import sys
+
+
+def fnv1a(data):
+    h = 14695981039346656037
+    for b in data:
+        h ^= b
+        h = (h * 1099511628211) & 0xFFFFFFFFFFFFFFFF
+    return h
+
+
+def axis(coords, tol):
+    """Origin, spacing and number of nodes of a regular axis."""
+    values = sorted(coords)
+    nodes = [values[0]]
+    for v in values[1:]:
+        if v - nodes[-1] > tol:
+            nodes.append(v)
+    if len(nodes) == 1:
+        return nodes[0], 0.0, 1
+    spacing = (nodes[-1] - nodes[0]) / (len(nodes) - 1)
+    for i, v in enumerate(nodes):
+        if abs(v - (nodes[0] + i * spacing)) > tol:
+            sys.exit('the points are not on a regular grid')
+    return nodes[0], spacing, len(nodes)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('input', help='text file with the grid points')
+    parser.add_argument('output', help='binary grid file')
+    parser.add_argument('--names', nargs='+', required=True, help='names of the fields')
+    parser.add_argument('--dtype', choices=['float32', 'float64'], default='float64')
+    parser.add_argument('--tolerance', type=float, default=1e-6,
+                        help='tolerance on the coordinates of the grid nodes')
+    args = parser.parse_args()
+
+    nvar = len(args.names)
+    if any(len(name.encode()) > 32 for name in args.names):
+        sys.exit('field names are limited to 32 characters')
+    tokens = open(args.input).read().split()
+    ncol = 3 + nvar
+    if len(tokens) % ncol != 0:
+        sys.exit('%d values is not a multiple of %d columns' % (len(tokens), ncol))
+    rows = [[float(t) for t in tokens[i:i + ncol]] for i in range(0, len(tokens), ncol)]
+
+    grid = [axis([r[d] for r in rows], args.tolerance) for d in range(3)]
+    n = [g[2] for g in grid]
+    if len(rows) != n[0] * n[1] * n[2]:
+        sys.exit('%d points for a %d x %d x %d grid' % (len(rows), n[0], n[1], n[2]))
+
+    values = array.array('f' if args.dtype == 'float32' else 'd', [0.0] * (nvar * len(rows)))
+    for r in rows:
+        ijk = [int(round((r[d] - grid[d][0]) / grid[d][1])) if n[d] > 1 else 0 for d in range(3)]
+        node = (ijk[2] * n[1] + ijk[1]) * n[0] + ijk[0]
+        for v in range(nvar):
+            values[v * len(rows) + node] = r[3 + v]
+    if sys.byteorder != 'little':
+        values.byteswap()
+    data = values.tobytes()
+
+    with open(args.output, 'wb') as f:
+        f.write(b'GOLEMGRD')
+        f.write(struct.pack('<IIIIII', 1, values.itemsize, n[0], n[1], n[2], nvar))
+        f.write(struct.pack('<3d', *[g[0] for g in grid]))
+        f.write(struct.pack('<3d', *[g[1] for g in grid]))
+        f.write(struct.pack('<Q', fnv1a(data)))
+        for name in args.names:
+            f.write(name.encode().ljust(32, b'\0'))
+        f.write(data)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+"""Convert a GolemPropertyReadFile text file (one row of nprop values per
+element) into the memory-mapped binary property format.
+
+Layout (little endian):
+  magic 'GOLEMPRP', uint32 version (1), uint32 dtype (4: float32, 8: float64),
+  uint64 nelem, uint32 nprop, uint32 reserved, uint64 FNV-1a checksum of the values,
+  nprop property names of 32 bytes (zero padded), values stored row by row.
+"""
+
+import argparse
+import array
+import struct
+import sys
+
+
+def fnv1a(data):
+    h = 14695981039346656037
+    for b in data:
+        h ^= b
+        h = (h * 1099511628211) & 0xFFFFFFFFFFFFFFFF
+    return h
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('input', help='text property file')
+    parser.add_argument('output', help='binary property file')
+    parser.add_argument('--names', nargs='+', required=True,
+                        help='names of the properties, in the order of the columns')
+    parser.add_argument('--dtype', choices=['float32', 'float64'], default='float64')
+    args = parser.parse_args()
+
+    nprop = len(args.names)
+    if any(len(name.encode()) > 32 for name in args.names):
+        sys.exit('property names are limited to 32 characters')
+
+    values = array.array('f' if args.dtype == 'float32' else 'd')
+    with open(args.input) as f:
+        for token in f.read().split():
+            values.append(float(token))
+    if len(values) % nprop != 0:
+        sys.exit('%d values is not a multiple of %d properties' % (len(values), nprop))
+    if sys.byteorder != 'little':
+        values.byteswap()
+    data = values.tobytes()
+
+    with open(args.output, 'wb') as f:
+        f.write(b'GOLEMPRP')
+        f.write(struct.pack('<IIQIIQ', 1, values.itemsize, len(values) // nprop, nprop, 0,
+                            fnv1a(data)))
+        for name in args.names:
+            f.write(name.encode().ljust(32, b'\0'))
+        f.write(data)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,90 @@
+# Transient boundary values given in four time frames, linearly interpolated in time. All the
+# nodes of the mesh lie on the boundary and on the points of the frames so that the solution
+# holds the sampled values: v = x + y, 2 x + 3 y + 100, 50 - x + y and 0.5 x + 200 at
+# t = 0, 10, 20 and 30 (last frame after t = 30)
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 2
+  ny = 2
+  nz = 1
+  xmin = 0
+  xmax = 100
+  ymin = 0
+  ymax = 100
+  zmin = 0
+  zmax = 10
+[]
+
+[Variables]
+  [temperature]
+  []
+[]
+
+[Functions]
+  [func_bc]
+    type = GolemFunctionBCFromFile
+    data_file = bc_frames.dat
+    interpolate_data_in_time = true
+    interpolate_data_in_space = true
+  []
+[]
+
+[BCs]
+  [bc]
+    type = FunctionDirichletBC
+    function = func_bc
+    boundary = 'left right bottom top back front'
+    variable = temperature
+  []
+[]
+
+[Kernels]
+  [diffusion]
+    type = Diffusion
+    variable = temperature
+  []
+[]
+
+[Postprocessors]
+  [T_0_0]
+    type = PointValue
+    variable = temperature
+    point = '0 0 10'
+  []
+  [T_100_0]
+    type = PointValue
+    variable = temperature
+    point = '100 0 10'
+  []
+  [T_50_50]
+    type = PointValue
+    variable = temperature
+    point = '50 50 0'
+  []
+  [T_0_100]
+    type = PointValue
+    variable = temperature
+    point = '0 100 0'
+  []
+  [T_sum]
+    type = NodalSum
+    variable = temperature
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  start_time = 0.0
+  end_time = 40.0
+  dt = 5.0
+  nl_abs_tol = 1e-10
+[]
+
+[Outputs]
+  [csv]
+    type = CSV
+    execute_on = 'timestep_end'
+  []
+[]
@@ -0,0 +1,85 @@
+# Boundary values given at the nodes of the mesh (no interpolation in space) in two time
+# frames, linearly interpolated in time: v = x + y at t = 0 and v = 2 x + 3 y + 100 at t = 10
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 2
+  ny = 2
+  nz = 1
+  xmin = 0
+  xmax = 100
+  ymin = 0
+  ymax = 100
+  zmin = 0
+  zmax = 10
+[]
+
+[Problem]
+  solve = false
+[]
+
+[AuxVariables]
+  [T_bc]
+  []
+[]
+
+[Functions]
+  [func_bc]
+    type = GolemFunctionBCFromFile
+    data_file = bc_index.dat
+    interpolate_data_in_time = true
+    interpolate_data_in_space = false
+  []
+[]
+
+[AuxKernels]
+  [T_bc]
+    type = FunctionAux
+    variable = T_bc
+    function = func_bc
+    execute_on = 'initial timestep_end'
+  []
+[]
+
+[Postprocessors]
+  [T_0_0]
+    type = PointValue
+    variable = T_bc
+    execute_on = 'initial timestep_end'
+    point = '0 0 10'
+  []
+  [T_100_0]
+    type = PointValue
+    variable = T_bc
+    execute_on = 'initial timestep_end'
+    point = '100 0 10'
+  []
+  [T_50_50]
+    type = PointValue
+    variable = T_bc
+    execute_on = 'initial timestep_end'
+    point = '50 50 0'
+  []
+  [T_0_100]
+    type = PointValue
+    variable = T_bc
+    execute_on = 'initial timestep_end'
+    point = '0 100 0'
+  []
+  [T_sum]
+    type = NodalSum
+    variable = T_bc
+    execute_on = 'initial timestep_end'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  start_time = 0.0
+  end_time = 10.0
+  dt = 2.5
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,70 @@
+# Samples the top boundary data of GMS.i between the points of the file, interpolated in space
+# from the 16 nearest points only
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  xmin = 376000
+  xmax = 396000
+  ymin = 5426000
+  ymax = 5442000
+  zmin = -1000
+  zmax = 0
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Functions]
+  [func_bc_0]
+    type = GolemFunctionBCFromFile
+    data_file = bc_file_0.dat
+    interpolate_data_in_time = false
+    interpolate_data_in_space = true
+    num_neighbors = 16
+  []
+[]
+
+[Postprocessors]
+  [T_a]
+    type = FunctionValuePostprocessor
+    function = func_bc_0
+    point = '394435.3 5438896.8 0'
+    execute_on = 'initial'
+  []
+  [T_b]
+    type = FunctionValuePostprocessor
+    function = func_bc_0
+    point = '394961.1 5440449.5 0'
+    execute_on = 'initial'
+  []
+  [T_c]
+    type = FunctionValuePostprocessor
+    function = func_bc_0
+    point = '385543.9 5438517.2 0'
+    execute_on = 'initial'
+  []
+  [T_d]
+    type = FunctionValuePostprocessor
+    function = func_bc_0
+    point = '393957.1 5438654.7 0'
+    execute_on = 'initial'
+  []
+  [T_point]
+    type = FunctionValuePostprocessor
+    function = func_bc_0
+    point = '384000.0 5437000.0 0'
+    execute_on = 'initial'
+  []
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  [csv]
+    type = CSV
+    execute_on = 'initial'
+  []
+[]
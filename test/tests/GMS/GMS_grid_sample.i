@@ -0,0 +1,110 @@
+# Samples the temperature field of GMS_grid.bin (T = 10 - 0.03 z between z = -2500 and
+# z = 500, nearest face value outside) with GolemGridIC and GolemFunctionGrid
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 2
+  ny = 2
+  nz = 9
+  xmin = 375817.689301
+  xmax = 395817.689301
+  ymin = 5425572.077202
+  ymax = 5441572.077202
+  zmin = -3500
+  zmax = 1000
+[]
+
+[Problem]
+  solve = false
+[]
+
+[AuxVariables]
+  [T_ic]
+  []
+[]
+
+[ICs]
+  [T_ic]
+    type = GolemGridIC
+    variable = T_ic
+    grid_file = GMS_grid.bin
+    field = temperature
+  []
+[]
+
+[Functions]
+  [T_grid]
+    type = GolemFunctionGrid
+    grid_file = GMS_grid.bin
+    field = temperature
+  []
+[]
+
+[Postprocessors]
+  [T_ic_below]
+    type = PointValue
+    variable = T_ic
+    point = '385817.689301 5433572.077202 -3500'
+  []
+  [T_ic_bottom]
+    type = PointValue
+    variable = T_ic
+    point = '385817.689301 5433572.077202 -2500'
+  []
+  [T_ic_inside]
+    type = PointValue
+    variable = T_ic
+    point = '385817.689301 5433572.077202 -1000'
+  []
+  [T_ic_zero]
+    type = PointValue
+    variable = T_ic
+    point = '385817.689301 5433572.077202 0'
+  []
+  [T_ic_top]
+    type = PointValue
+    variable = T_ic
+    point = '385817.689301 5433572.077202 500'
+  []
+  [T_ic_above]
+    type = PointValue
+    variable = T_ic
+    point = '385817.689301 5433572.077202 1000'
+  []
+  [T_func_inside]
+    type = FunctionValuePostprocessor
+    function = T_grid
+    point = '385817.689301 5433572.077202 -1125'
+  []
+  [T_func_below]
+    type = FunctionValuePostprocessor
+    function = T_grid
+    point = '385817.689301 5433572.077202 -4000'
+  []
+  [T_func_above]
+    type = FunctionValuePostprocessor
+    function = T_grid
+    point = '385817.689301 5433572.077202 2000'
+  []
+  [T_func_outside_x]
+    type = FunctionValuePostprocessor
+    function = T_grid
+    point = '300000 5433572.077202 -1000'
+  []
+  [T_func_outside_xy]
+    type = FunctionValuePostprocessor
+    function = T_grid
+    point = '500000 5500000 -1000'
+  []
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  [csv]
+    type = CSV
+    execute_on = 'initial'
+  []
+[]
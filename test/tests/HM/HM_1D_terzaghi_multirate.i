@@ -0,0 +1,264 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 1
+  ny = 1
+  nz = 10
+  xmin = -1
+  xmax = 1
+  ymin = -1
+  ymax = 1
+  zmin = 0
+  zmax = 10
+[]
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+  pore_pressure = pore_pressure
+  block = 0
+[]
+
+[Variables]
+  [disp_x]
+  []
+  [disp_y]
+  []
+  [disp_z]
+  []
+[]
+
+[AuxVariables]
+  [pore_pressure]
+  []
+[]
+
+[BCs]
+  [confinex]
+    type = DirichletBC
+    variable = disp_x
+    value = 0
+    boundary = 'left right'
+    preset = true
+  []
+  [confiney]
+    type = DirichletBC
+    variable = disp_y
+    value = 0
+    boundary = 'bottom top'
+    preset = true
+  []
+  [basefixed]
+    type = DirichletBC
+    variable = disp_z
+    value = 0
+    boundary = back
+    preset = true
+  []
+  [topload]
+    type = NeumannBC
+    variable = disp_z
+    value = -1
+    boundary = front
+  []
+[]
+
+[Kernels]
+  [MKernel_x]
+    type = GolemKernelM
+    variable = disp_x
+    component = 0
+  []
+  [MKernel_y]
+    type = GolemKernelM
+    variable = disp_y
+    component = 1
+  []
+  [MKernel_z]
+    type = GolemKernelM
+    variable = disp_z
+    component = 2
+  []
+[]
+
+[Materials]
+  [HMMaterial]
+    type = GolemMaterialMElastic
+    block = 0
+    strain_model = incr_small_strain
+    lame_modulus = 2
+    shear_modulus = 3
+    permeability_initial = 1.5
+    fluid_viscosity_initial = 1.0
+    porosity_initial = 0.1
+    solid_bulk_modulus = 10
+    fluid_modulus = 8
+    porosity_uo = porosity
+    fluid_density_uo = fluid_density
+    fluid_viscosity_uo = fluid_viscosity
+    permeability_uo = permeability
+  []
+[]
+
+[UserObjects]
+  [porosity]
+    type = GolemPorosityConstant
+  []
+  [fluid_density]
+    type = GolemFluidDensityConstant
+  []
+  [fluid_viscosity]
+    type = GolemFluidViscosityConstant
+  []
+  [permeability]
+    type = GolemPermeabilityConstant
+  []
+[]
+
+[Preconditioning]
+  [andy]
+    type = SMP
+    full = true
+    petsc_options_iname = '-ksp_type -pc_type -snes_atol -snes_rtol -snes_max_it'
+    petsc_options_value = 'bcgs bjacobi 1E-14 1E-10 10000'
+  []
+[]
+
+[Postprocessors]
+  [strain_rate_change]
+    type = GolemVolumetricStrainRateChange
+    execute_on = 'timestep_end'
+    outputs = none
+  []
+  [p0]
+    type = PointValue
+    outputs = csv
+    execute_on = 'final'
+    point = '0 0 0'
+    variable = pore_pressure
+  []
+  [p1]
+    type = PointValue
+    outputs = csv
+    execute_on = 'final'
+    point = '0 0 1'
+    variable = pore_pressure
+  []
+  [p2]
+    type = PointValue
+    outputs = csv
+    execute_on = 'final'
+    point = '0 0 2'
+    variable = pore_pressure
+  []
+  [p3]
+    type = PointValue
+    outputs = csv
+    execute_on = 'final'
+    point = '0 0 3'
+    variable = pore_pressure
+  []
+  [p4]
+    type = PointValue
+    outputs = csv
+    execute_on = 'final'
+    point = '0 0 4'
+    variable = pore_pressure
+  []
+  [p5]
+    type = PointValue
+    outputs = csv
+    execute_on = 'final'
+    point = '0 0 5'
+    variable = pore_pressure
+  []
+  [p6]
+    type = PointValue
+    outputs = csv
+    execute_on = 'final'
+    point = '0 0 6'
+    variable = pore_pressure
+  []
+  [p7]
+    type = PointValue
+    outputs = csv
+    execute_on = 'final'
+    point = '0 0 7'
+    variable = pore_pressure
+  []
+  [p8]
+    type = PointValue
+    outputs = csv
+    execute_on = 'final'
+    point = '0 0 8'
+    variable = pore_pressure
+  []
+  [p9]
+    type = PointValue
+    outputs = csv
+    execute_on = 'final'
+    point = '0 0 9'
+    variable = pore_pressure
+  []
+  [p99]
+    type = PointValue
+    outputs = csv
+    execute_on = 'final'
+    point = '0 0 10'
+    variable = pore_pressure
+  []
+  [zdisp]
+    type = PointValue
+    outputs = csv
+    execute_on = 'final'
+    point = '0 0 10'
+    variable = disp_z
+  []
+[]
+
+[MultiApps]
+  [flow]
+    type = TransientMultiApp
+    input_files = HM_1D_terzaghi_multirate_flow.i
+    sub_cycling = true
+    interpolate_transfers = true
+    execute_on = 'timestep_end'
+  []
+[]
+
+[Transfers]
+  [displacements_to_flow]
+    type = MultiAppCopyTransfer
+    to_multi_app = flow
+    source_variable = 'disp_x disp_y disp_z'
+    variable = 'disp_x disp_y disp_z'
+  []
+  [pore_pressure_from_flow]
+    type = MultiAppCopyTransfer
+    from_multi_app = flow
+    source_variable = pore_pressure
+    variable = pore_pressure
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = Newton
+  start_time = 0
+  end_time = 10
+  [TimeStepper]
+    type = GolemMultirateDT
+    strain_rate_change = strain_rate_change
+    micro_dt = 0.01
+    initial_substeps = 2
+    max_substeps = 10
+    tolerance = 0.1
+  []
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  [csv]
+    type = CSV
+    execute_on = 'final'
+  []
+[]
@@ -0,0 +1,273 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 10
+  ny = 1
+  nz = 1
+  xmin = 0
+  xmax = 1
+  ymin = 0
+  ymax = 0.1
+  zmin = 0
+  zmax = 1
+[]
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+  pore_pressure = pore_pressure
+[]
+
+[Variables]
+  [pore_pressure]
+  []
+[]
+
+[AuxVariables]
+  [disp_x]
+  []
+  [disp_y]
+  []
+  [disp_z]
+  []
+  [pore_pressure_fs]
+  []
+  [stress_yy]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [tot_force]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [stress_yy]
+    type = GolemStress
+    variable = stress_yy
+    index_i = 1
+    index_j = 1
+  []
+  [tot_force]
+    type = ParsedAux
+    coupled_variables = 'stress_yy pore_pressure'
+    execute_on = timestep_end
+    variable = tot_force
+    expression = '-stress_yy+0.6*pore_pressure'
+  []
+[]
+
+[BCs]
+  [xmax_drained]
+    type = DirichletBC
+    variable = pore_pressure
+    value = 0
+    boundary = right
+    preset = false
+  []
+[]
+
+[Kernels]
+  [p_time]
+    type = GolemKernelTimeH
+    variable = pore_pressure
+  []
+  [HKernel]
+    type = GolemKernelH
+    variable = pore_pressure
+  []
+  [HMKernel]
+    type = GolemKernelHPoroElastic
+    variable = pore_pressure
+  []
+  [FSKernel]
+    type = GolemKernelHFixedStress
+    variable = pore_pressure
+    pore_pressure_iterate = pore_pressure_fs
+  []
+[]
+
+[Materials]
+  [HMMaterial]
+    type = GolemMaterialMElastic
+    block = 0
+    strain_model = incr_small_strain
+    lame_modulus = 0.5
+    shear_modulus = 0.75
+    permeability_initial = 1.5e-03
+    fluid_viscosity_initial = 1.0e-03
+    porosity_initial = 0.1
+    solid_bulk_modulus = 2.5
+    fluid_modulus = 8
+    porosity_uo = porosity
+    fluid_density_uo = fluid_density
+    fluid_viscosity_uo = fluid_viscosity
+    permeability_uo = permeability
+  []
+[]
+
+[UserObjects]
+  [porosity]
+    type = GolemPorosityConstant
+  []
+  [fluid_density]
+    type = GolemFluidDensityConstant
+  []
+  [fluid_viscosity]
+    type = GolemFluidViscosityConstant
+  []
+  [permeability]
+    type = GolemPermeabilityConstant
+  []
+[]
+
+[Postprocessors]
+  [p0]
+    type = PointValue
+    outputs = csv
+    point = '0.0 0 0'
+    variable = pore_pressure
+  []
+  [p1]
+    type = PointValue
+    outputs = csv
+    point = '0.1 0 0'
+    variable = pore_pressure
+  []
+  [p2]
+    type = PointValue
+    outputs = csv
+    point = '0.2 0 0'
+    variable = pore_pressure
+  []
+  [p3]
+    type = PointValue
+    outputs = csv
+    point = '0.3 0 0'
+    variable = pore_pressure
+  []
+  [p4]
+    type = PointValue
+    outputs = csv
+    point = '0.4 0 0'
+    variable = pore_pressure
+  []
+  [p5]
+    type = PointValue
+    outputs = csv
+    point = '0.5 0 0'
+    variable = pore_pressure
+  []
+  [p6]
+    type = PointValue
+    outputs = csv
+    point = '0.6 0 0'
+    variable = pore_pressure
+  []
+  [p7]
+    type = PointValue
+    outputs = csv
+    point = '0.7 0 0'
+    variable = pore_pressure
+  []
+  [p8]
+    type = PointValue
+    outputs = csv
+    point = '0.8 0 0'
+    variable = pore_pressure
+  []
+  [p9]
+    type = PointValue
+    outputs = csv
+    point = '0.9 0 0'
+    variable = pore_pressure
+  []
+  [p99]
+    type = PointValue
+    outputs = csv
+    point = '1 0 0'
+    variable = pore_pressure
+  []
+  [xdisp]
+    type = PointValue
+    outputs = csv
+    point = '1 0.1 0'
+    variable = disp_x
+  []
+  [ydisp]
+    type = PointValue
+    outputs = csv
+    point = '1 0.1 0'
+    variable = disp_y
+  []
+  [total_downwards_force]
+     type = ElementAverageValue
+     outputs = csv
+     variable = tot_force
+  []
+  [dt]
+    type = FunctionValuePostprocessor
+    outputs = console
+    function = if(0.15*t<0.01,0.15*t,0.01)
+  []
+  [coupling_iterations]
+    type = NumFixedPointIterations
+    outputs = console
+  []
+[]
+
+[MultiApps]
+  [mechanics]
+    type = TransientMultiApp
+    input_files = HM_2D_mandel_fs_mechanics.i
+    execute_on = 'timestep_end'
+  []
+[]
+
+[Transfers]
+  [pore_pressure_to_mechanics]
+    type = MultiAppCopyTransfer
+    to_multi_app = mechanics
+    source_variable = pore_pressure
+    variable = pore_pressure
+  []
+  [from_mechanics]
+    type = MultiAppCopyTransfer
+    from_multi_app = mechanics
+    source_variable = 'disp_x disp_y disp_z pore_pressure'
+    variable = 'disp_x disp_y disp_z pore_pressure_fs'
+  []
+[]
+
+[Preconditioning]
+  [andy]
+    type = SMP
+    full = true
+    petsc_options_iname = '-ksp_type -pc_type -snes_atol -snes_rtol -snes_max_it'
+    petsc_options_value = 'bcgs bjacobi 1E-14 1E-10 10000'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = Newton
+  fixed_point_max_its = 200
+  fixed_point_rel_tol = 1e-8
+  fixed_point_abs_tol = 1e-12
+  start_time = 0
+  end_time = 0.7
+  [TimeStepper]
+    type = PostprocessorDT
+    postprocessor = dt
+    dt = 0.001
+  []
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  [csv]
+    interval = 3
+    type = CSV
+    file_base = HM_2D_mandel_csv
+  []
+[]
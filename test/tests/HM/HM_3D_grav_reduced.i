@@ -0,0 +1,261 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 2
+  ny = 2
+  nz = 10
+  xmin = 0
+  xmax = 6
+  ymin = 0
+  ymax = 6
+  zmin = 0
+  zmax = 30
+[]
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+  pore_pressure = pore_pressure
+[]
+
+[Variables]
+  [pore_pressure]
+    order = FIRST
+    family = LAGRANGE
+  []
+  [disp_x]
+    order = FIRST
+    family = LAGRANGE
+  []
+  [disp_y]
+    order = FIRST
+    family = LAGRANGE
+  []
+  [disp_z]
+    order = FIRST
+    family = LAGRANGE
+  []
+[]
+
+[Kernels]
+  [HKernel]
+    type = GolemKernelH
+    variable = pore_pressure
+  []
+  [MKernel_x]
+    type = GolemKernelM
+    variable = disp_x
+    component = 0
+  []
+  [MKernel_y]
+    type = GolemKernelM
+    variable = disp_y
+    component = 1
+  []
+  [MKernel_z]
+    type = GolemKernelM
+    variable = disp_z
+    component = 2
+  []
+  [hourglass_p]
+    type = GolemKernelHHourglass
+    variable = pore_pressure
+  []
+  [hourglass_x]
+    type = GolemKernelMHourglass
+    variable = disp_x
+  []
+  [hourglass_y]
+    type = GolemKernelMHourglass
+    variable = disp_y
+  []
+  [hourglass_z]
+    type = GolemKernelMHourglass
+    variable = disp_z
+  []
+[]
+
+[Quadrature]
+  type = GAUSS
+  order = CONSTANT
+[]
+
+[AuxVariables]
+  [strain_zz]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [stress_zz]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [strain_zz]
+    type = GolemStrain
+    variable = strain_zz
+    index_i = 2
+    index_j = 2
+  []
+  [stress_zz]
+    type = GolemStress
+    variable = stress_zz
+    index_i = 2
+    index_j = 2
+  []
+[]
+
+[BCs]
+  [p0_front]
+    type = DirichletBC
+    variable = pore_pressure
+    boundary = front
+    value = 0.0
+    preset = false
+  []
+  [no_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = 'left right'
+    value = 0.0
+    preset = true
+  []
+  [no_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 'bottom top'
+    value = 0.0
+    preset = true
+  []
+  [no_z_back]
+    type = DirichletBC
+    variable = disp_z
+    boundary = back
+    value = 0.0
+    preset = true
+  []
+[]
+
+[Materials]
+  [HMMaterial]
+    type = GolemMaterialMElastic
+    block = 0
+    strain_model = incr_small_strain
+    has_gravity = true
+    gravity_acceleration = 9.81
+    solid_density_initial = 3058.104
+    fluid_density_initial = 1019.368
+    young_modulus = 10.0e+09
+    poisson_ratio = 0.25
+    permeability_initial = 1.0e-10
+    fluid_viscosity_initial = 1.0e-03
+    porosity_uo = porosity
+    fluid_density_uo = fluid_density
+    fluid_viscosity_uo = fluid_viscosity
+    permeability_uo = permeability
+  []
+[]
+
+[UserObjects]
+  [porosity]
+    type = GolemPorosityConstant
+  []
+  [fluid_density]
+    type = GolemFluidDensityConstant
+  []
+  [fluid_viscosity]
+    type = GolemFluidViscosityConstant
+  []
+  [permeability]
+    type = GolemPermeabilityConstant
+  []
+[]
+
+[Functions]
+  [p_analytical]
+    type = ParsedFunction
+    expression = 'rho_f*g*(H-z)'
+    symbol_names = 'rho_f g H'
+    symbol_values = '1019.368 9.81 30'
+  []
+  [disp_z_analytical]
+    type = ParsedFunction
+    expression = '-(rho_s-rho_f)*g*(H*z-1/2*z*z)/(E*(1-nu)/((1+nu)*(1-2*nu)))'
+    symbol_names = 'rho_s rho_f g H E nu'
+    symbol_values = '3058.104 1019.368 9.81 30 10.0e+09 0.25'
+  []
+[]
+
+# Cost and accuracy against full integration (Quadrature/order=SECOND): the 40 HEX8
+# elements evaluate the material at 40 instead of 320 quadrature points per residual and
+# Jacobian. The pressure is linear and the displacement linear in z within each element,
+# so the one-point rule integrates the Darcy flux, the stiffness, the Biot coupling and the
+# body force exactly and the hourglass modes of the pressure and the displacements are not
+# excited: both rules give the analytical nodal solution (errors at round-off).
+[Postprocessors]
+  [p_top]
+    type = PointValue
+    variable = pore_pressure
+    point = '0 0 30'
+  []
+  [p_middle]
+    type = PointValue
+    variable = pore_pressure
+    point = '3 3 15'
+  []
+  [p_low]
+    type = PointValue
+    variable = pore_pressure
+    point = '6 6 6'
+  []
+  [uz_top]
+    type = PointValue
+    variable = disp_z
+    point = '0 0 30'
+  []
+  [uz_middle]
+    type = PointValue
+    variable = disp_z
+    point = '3 3 15'
+  []
+  [uz_low]
+    type = PointValue
+    variable = disp_z
+    point = '6 6 6'
+  []
+  [error_p]
+    type = NodalL2Error
+    variable = pore_pressure
+    function = p_analytical
+  []
+  [error_uz]
+    type = NodalL2Error
+    variable = disp_z
+    function = disp_z_analytical
+  []
+[]
+
+[Preconditioning]
+  [precond]
+    type = SMP
+    full = true
+    petsc_options = '-snes_ksp_ew'
+    petsc_options_iname = '-ksp_type -pc_type -snes_atol -snes_rtol -snes_max_it -ksp_max_it -sub_pc_type -sub_pc_factor_shift_type'
+    petsc_options_value = 'gmres asm 1E-10 1E-10 200 500 lu NONZERO'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = Newton
+  start_time = 0.0
+  end_time = 1.0
+  dt = 1.0
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  print_linear_residuals = true
+  perf_graph = true
+  csv = true
+[]
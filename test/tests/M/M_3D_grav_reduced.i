@@ -0,0 +1,228 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 2
+  ny = 2
+  nz = 10
+  xmin = 0
+  xmax = 6
+  ymin = 0
+  ymax = 6
+  zmin = 0
+  zmax = 30
+[]
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Variables]
+  [disp_x]
+    order = FIRST
+    family = LAGRANGE
+  []
+  [disp_y]
+    order = FIRST
+    family = LAGRANGE
+  []
+  [disp_z]
+    order = FIRST
+    family = LAGRANGE
+  []
+[]
+
+[Kernels]
+  [MKernel_x]
+    type = GolemKernelM
+    variable = disp_x
+    component = 0
+  []
+  [MKernel_y]
+    type = GolemKernelM
+    variable = disp_y
+    component = 1
+  []
+  [MKernel_z]
+    type = GolemKernelM
+    variable = disp_z
+    component = 2
+  []
+  [hourglass_x]
+    type = GolemKernelMHourglass
+    variable = disp_x
+  []
+  [hourglass_y]
+    type = GolemKernelMHourglass
+    variable = disp_y
+  []
+  [hourglass_z]
+    type = GolemKernelMHourglass
+    variable = disp_z
+  []
+[]
+
+[Quadrature]
+  type = GAUSS
+  order = CONSTANT
+[]
+
+[AuxVariables]
+  [strain_zz]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [stress_zz]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  #[strain_zz_analytical]
+  #  order = CONSTANT
+  #  family = MONOMIAL
+  #[]
+  #[stress_zz_analytical]
+  #  order = CONSTANT
+  #  family = MONOMIAL
+  #[]
+[]
+
+[AuxKernels]
+  [strain_zz]
+    type = GolemStrain
+    variable = strain_zz
+    index_i = 2
+    index_j = 2
+  []
+  [stress_zz]
+    type = GolemStress
+    variable = stress_zz
+    index_i = 2
+    index_j = 2
+  []
+  #[strain_zz_analytical]
+  #  type = FunctionAux
+  #  variable = strain_zz_analytical
+  #  function = strain_zz_analytical
+  #[]
+  #[stress_zz_analytical]
+  #  type = FunctionAux
+  #  variable = stress_zz_analytical
+  #  function = stress_zz_analytical
+  #[]
+[]
+
+[Functions]
+  [disp_z_analytical]
+    type = ParsedFunction
+    expression = '1/E*(1-2*nu*nu/(1-nu))*rho*(-g)*(H*z-1/2*z*z)'
+    symbol_names = 'E nu rho g H'
+    symbol_values = '10.0e+09 0.25 3058.104 9.81 30'
+  []
+[]
+
+[BCs]
+  [no_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = 'left right'
+    value = 0.0
+    preset = true
+  []
+  [no_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 'bottom top'
+    value = 0.0
+    preset = true
+  []
+  [no_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = back
+    value = 0.0
+    preset = true
+  []
+[]
+
+[Materials]
+  [MMaterial]
+    type = GolemMaterialMElastic
+    block = 0
+    has_gravity = true
+    solid_density_initial = 3058.104
+    gravity_acceleration = 9.81
+    strain_model = small_strain
+    young_modulus = 10.0e+09
+    poisson_ratio = 0.25
+    porosity_uo = porosity
+    fluid_density_uo = fluid_density
+  []
+[]
+
+[UserObjects]
+  [porosity]
+    type = GolemPorosityConstant
+  []
+  [fluid_density]
+    type = GolemFluidDensityConstant
+  []
+[]
+
+# Cost and accuracy against full integration (Quadrature/order=SECOND): the 40 HEX8
+# elements evaluate the material at 40 instead of 320 quadrature points per residual and
+# Jacobian. The displacement is linear in z within each element, so the one-point rule
+# integrates the stiffness and the body force exactly and the hourglass modes are not
+# excited: both rules give the analytical nodal solution (error_uz at round-off).
+[Postprocessors]
+  [uz_top]
+    type = PointValue
+    variable = disp_z
+    point = '0 0 30'
+  []
+  [uz_middle]
+    type = PointValue
+    variable = disp_z
+    point = '3 3 15'
+  []
+  [uz_low]
+    type = PointValue
+    variable = disp_z
+    point = '6 6 6'
+  []
+  [error_uz]
+    type = NodalL2Error
+    variable = disp_z
+    function = disp_z_analytical
+  []
+[]
+
+[Preconditioning]
+  [hypre]
+    type = SMP
+    full = true
+    petsc_options_iname = '-pc_type -pc_hypre_type
+                           -ksp_type -ksp_rtol -ksp_max_it
+                           -snes_type -snes_atol -snes_rtol -snes_max_it
+                           -ksp_gmres_restart'
+    petsc_options_value = 'hypre boomeramg
+                           fgmres 1e-10 100
+                           newtonls 1e-05 1e-10 100
+                           201'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  automatic_scaling = true
+  start_time = 0.0
+  end_time = 1.0
+  dt = 1.0
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  print_linear_residuals = true
+  perf_graph = true
+  file_base = M_3D_grav_reduced_out
+  csv = true
+[]
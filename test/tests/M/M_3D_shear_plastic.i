@@ -0,0 +1,262 @@
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 3
+    nx = 4
+    ny = 4
+    nz = 4
+    xmin = 0
+    xmax = 1
+    ymin = 0
+    ymax = 1
+    zmin = 0
+    zmax = 1
+  []
+  [weak]
+    type = SubdomainBoundingBoxGenerator
+    input = gen
+    block_id = 1
+    bottom_left = '0 0 0'
+    top_right = '1 1 0.5'
+  []
+  [Partitioner]
+    type = GolemPartitioner
+  []
+[]
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Variables]
+  [disp_x]
+    order = FIRST
+    family = LAGRANGE
+  []
+  [disp_y]
+    order = FIRST
+    family = LAGRANGE
+  []
+  [disp_z]
+    order = FIRST
+    family = LAGRANGE
+  []
+[]
+
+[Kernels]
+  [MKernel_x]
+    type = GolemKernelM
+    variable = disp_x
+    component = 0
+  []
+  [MKernel_y]
+    type = GolemKernelM
+    variable = disp_y
+    component = 1
+  []
+  [MKernel_z]
+    type = GolemKernelM
+    variable = disp_z
+    component = 2
+  []
+[]
+
+[AuxVariables]
+  [inelastic_strain_xy]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [stress_xy]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [inelastic_strain_xy]
+    type = GolemStrain
+    variable = inelastic_strain_xy
+    strain_type = inelastic
+    index_i = 0
+    index_j = 1
+  []
+  [stress_xy]
+    type = GolemStress
+    variable = stress_xy
+    index_i = 0
+    index_j = 1
+  []
+[]
+
+[Functions]
+  [disp_y_func]
+    type = ParsedFunction
+    expression = 'm*t*x'
+    symbol_names = 'm'
+    symbol_values = '0.001'
+  []
+[]
+
+[BCs]
+  [no_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = 'left right bottom top front back'
+    value = 0.0
+    preset = true
+  []
+  [no_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = 'left right bottom top front back'
+    value = 0.0
+    preset = true
+  []
+  [disp_y_plate]
+    type = FunctionDirichletBC
+    variable = disp_y
+    boundary = 'left right bottom top front back'
+    function = disp_y_func
+    preset = true
+  []
+[]
+
+[Materials]
+  [MMaterial_strong]
+    type = GolemMaterialMInelastic
+    block = 0
+    strain_model = incr_small_strain
+    young_modulus = 10.0e+09
+    poisson_ratio = 0.25
+    porosity_uo = porosity
+    fluid_density_uo = fluid_density
+    inelastic_models = 'DP_strong'
+  []
+  [DP_strong]
+    type = GolemDruckerPrager
+    block = 0
+    MC_cohesion = cohesion_strong
+    MC_friction = friction
+    MC_dilation = dilation
+    yield_function_tol = 1.0
+  []
+  [MMaterial_weak]
+    type = GolemMaterialMInelastic
+    block = 1
+    strain_model = incr_small_strain
+    young_modulus = 10.0e+09
+    poisson_ratio = 0.25
+    porosity_uo = porosity
+    fluid_density_uo = fluid_density
+    inelastic_models = 'DP_weak'
+  []
+  [DP_weak]
+    type = GolemDruckerPrager
+    block = 1
+    MC_cohesion = cohesion_weak
+    MC_friction = friction
+    MC_dilation = dilation
+    yield_function_tol = 1.0
+  []
+[]
+
+[UserObjects]
+  [porosity]
+    type = GolemPorosityConstant
+  []
+  [fluid_density]
+    type = GolemFluidDensityConstant
+  []
+  [cohesion_strong]
+    type = GolemHardeningConstant
+    value = 1.0e+09
+  []
+  [cohesion_weak]
+    type = GolemHardeningConstant
+    value = 6.0e+06
+  []
+  [friction]
+    type = GolemHardeningConstant
+    value = 0.0
+  []
+  [dilation]
+    type = GolemHardeningConstant
+    value = 0.0
+  []
+  [repartition]
+    type = GolemRepartition
+    interval = 1
+    return_map_iterations = return_map_iterations
+  []
+[]
+
+# Uniform simple shear: the stress of the weak block is capped at the cohesion (6 MPa) from
+# t = 1.5 on, its inelastic strain (stateful) grows as 0.0005 * t - 0.00075
+[Postprocessors]
+  [stress_xy_strong_max]
+    type = ElementExtremeValue
+    variable = stress_xy
+    value_type = max
+    block = 0
+  []
+  [stress_xy_strong_min]
+    type = ElementExtremeValue
+    variable = stress_xy
+    value_type = min
+    block = 0
+  []
+  [stress_xy_weak_max]
+    type = ElementExtremeValue
+    variable = stress_xy
+    value_type = max
+    block = 1
+  []
+  [stress_xy_weak_min]
+    type = ElementExtremeValue
+    variable = stress_xy
+    value_type = min
+    block = 1
+  []
+  [inelastic_strain_xy_weak_max]
+    type = ElementExtremeValue
+    variable = inelastic_strain_xy
+    value_type = max
+    block = 1
+  []
+  [inelastic_strain_xy_weak_min]
+    type = ElementExtremeValue
+    variable = inelastic_strain_xy
+    value_type = min
+    block = 1
+  []
+[]
+
+[Preconditioning]
+  [hypre]
+    type = SMP
+    full = true
+    petsc_options_iname = '-pc_type -pc_hypre_type
+                           -ksp_type -ksp_rtol -ksp_max_it
+                           -snes_type -snes_atol -snes_rtol -snes_max_it
+                           -ksp_gmres_restart'
+    petsc_options_value = 'hypre boomeramg
+                           fgmres 1e-10 100
+                           newtonls 1e-05 1e-10 100
+                           201'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  start_time = 0.0
+  end_time = 4.0
+  dt = 1.0
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  print_linear_residuals = true
+  perf_graph = true
+  csv = true
+[]